@@ -0,0 +1,1043 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "host.h"
+#include "demo.h"
+#include "clear.h"
+#include "transform.h"
+#include "scene.h"
+#include "strip.h"
+#include "trig.h"
+#include "reference.h"
+#include "golden.h"
+#include "profile.h"
+#include "present.h"
+#include "arena.h"
+#include "animblob.h"
+#include "stack.h"
+#include "replay.h"
+
+// Headless frame benchmark: renders a fixed, scripted run of the demo into
+// the in-memory pages, reports per-zone wall time from the frame profiler
+// and checks each presented frame against the stored golden hashes.
+
+#define DEFAULT_FRAMES GOLDEN_FRAMES
+#define MICRO_POSES 64
+#define MICRO_REPS 50
+
+static const char* clear_mode_names[NUM_CLEAR_MODES] = { "full", "dirty", "erase" };
+static unsigned long long zone_ticks[NUM_PROF_ZONES]; // Whole-run totals
+
+// Deterministic input: A (torus) at 64, R (hidden lines) at 96, B (ortho)
+// at 128, A (scene) at 192, B (perspective) at 224.
+static unsigned short script_keys(int frame) {
+    if (frame == 96) return KEY_R;
+    if (frame == 64 || frame == 192) return KEY_A;
+    if (frame == 128 || frame == 224) return KEY_B;
+    return 0;
+}
+
+// With --replay the run plays back a recording instead of the script;
+// with --record (or check_replay) it records what it was fed.
+static const ReplayFrame* run_replay;
+static int run_replay_frames;
+static ReplayFrame* run_record;
+
+static int run_frames(int frames, unsigned int* hashes, enum ClearMode mode) {
+    stack_paint();
+    plat_init();
+    demo_init();
+    clear_set_mode(mode);
+    if (run_replay) replay_play(run_replay, run_replay_frames);
+    else if (run_record) replay_record(run_record, frames);
+    memset(zone_ticks, 0, sizeof(zone_ticks));
+    for (int f = 0; f < frames; f++) {
+        if (!run_replay) host_set_keys(script_keys(f));
+        demo_frame();
+        hashes[f] = host_hash_page(host_presented_page());
+        for (int z = 0; z < NUM_PROF_ZONES; z++) zone_ticks[z] += prof_sample(0, z);
+    }
+    replay_stop();
+    return frames;
+}
+
+// Recordings on disk: one frame per line, keys in hex then the phases.
+static int write_replay(const char* path, const ReplayFrame* frames, int count) {
+    FILE* f = fopen(path, "w");
+    if (!f) { perror(path); return 0; }
+    fprintf(f, "# replay: keys angle_x angle_y scene_angle pulse_angle anim_frame\n");
+    for (int i = 0; i < count; i++) {
+        const ReplayFrame* r = &frames[i];
+        fprintf(f, "%04x %u %u %u %u %u\n", r->keys, r->angle_x, r->angle_y, r->scene_angle, r->pulse_angle, r->anim_frame);
+    }
+    fclose(f);
+    return 1;
+}
+
+// Returns the frame count, or -1; *frames is malloc'ed.
+static int read_replay(const char* path, ReplayFrame** frames) {
+    FILE* f = fopen(path, "r");
+    if (!f) { perror(path); return -1; }
+    int count = 0, capacity = 256, line = 0;
+    char text[128];
+    *frames = malloc(capacity * sizeof(ReplayFrame));
+    while (fgets(text, sizeof(text), f)) {
+        line++;
+        if (text[0] == '#' || text[0] == '\n') continue;
+        ReplayFrame r;
+        if (sscanf(text, "%hx %hu %hu %hu %hu %hu", &r.keys, &r.angle_x, &r.angle_y, &r.scene_angle, &r.pulse_angle, &r.anim_frame) != 6 ||
+            r.angle_x >= TRIG_ANGLES || r.angle_y >= TRIG_ANGLES || r.pulse_angle >= TRIG_ANGLES || r.anim_frame >= RIPPLE_FRAMES) {
+            fprintf(stderr, "%s:%d: bad replay frame\n", path, line);
+            fclose(f); free(*frames);
+            return -1;
+        }
+        if (count == capacity) *frames = realloc(*frames, (capacity *= 2) * sizeof(ReplayFrame));
+        (*frames)[count++] = r;
+    }
+    fclose(f);
+    return count;
+}
+
+static unsigned long long ticks_to_ns(unsigned long long ticks) { return ticks * 1000000000ull >> 24; }
+
+static int zone_depth(int zone) { int d = 0; while (prof_zone_parent[zone] >= 0) { zone = prof_zone_parent[zone]; d++; } return d; }
+
+// Whole-run average plus the spread over the profiler ring (last frames).
+static void report_zones(int frames) {
+    if (!PROFILE_ENABLED) { printf("profiler disabled (PROFILE=0)\n"); return; }
+    printf("%-16s %12s %12s %12s\n", "zone", "ns/frame", "max", "p99");
+    for (int z = 0; z < NUM_PROF_ZONES; z++) {
+        ProfStats st;
+        prof_stats(z, &st);
+        printf("%*s%-*s %12llu %12llu %12llu\n", 2 * zone_depth(z), "", 16 - 2 * zone_depth(z), prof_zone_names[z],
+               ticks_to_ns(zone_ticks[z]) / frames, ticks_to_ns(st.max), ticks_to_ns(st.p99));
+    }
+}
+
+// Profiler ring as CSV, oldest frame first, one column per zone path, ns.
+static int dump_profile_csv(const char* path) {
+    FILE* f = fopen(path, "w");
+    if (!f) { perror(path); return 0; }
+    fprintf(f, "index");
+    for (int z = 0; z < NUM_PROF_ZONES; z++) {
+        const char* names[NUM_PROF_ZONES];
+        int n = 0;
+        for (int p = z; p >= 0; p = prof_zone_parent[p]) names[n++] = prof_zone_names[p];
+        fputc(',', f);
+        while (n--) fprintf(f, "%s%s", names[n], n ? "/" : "");
+    }
+    fputc('\n', f);
+    int frames = prof_frames();
+    for (int i = frames - 1; i >= 0; i--) {
+        fprintf(f, "%d", frames - 1 - i);
+        for (int z = 0; z < NUM_PROF_ZONES; z++) fprintf(f, ",%llu", ticks_to_ns(prof_sample(i, z)));
+        fputc('\n', f);
+    }
+    fclose(f);
+    return 1;
+}
+
+// --- Microbenchmarks ---
+static volatile int sink;
+
+// Host timings are noisy: run a block MICRO_TRIALS times and keep the fastest.
+#define MICRO_TRIALS 5
+#define TIME_BEST(ns, ...) do { ns = ~0ull; for (int t_ = 0; t_ < MICRO_TRIALS; t_++) { unsigned long long s_ = host_now_ns(); __VA_ARGS__; s_ = host_now_ns() - s_; if (s_ < ns) ns = s_; } } while (0)
+
+static void pose_points(int pose, enum CameraType camera, const VertexBuffer* out) {
+    Matrix3 m;
+    matrix_rotate_xy(&m, pose * 64, pose * 32);
+    transform_mesh(&torus_lods[TORUS_LOD_DEFAULT], &m, pipeline_select(camera), out);
+}
+
+// Vertices/ms of the old AoS two-rotation loop against the kernel on random
+// point clouds of increasing size. The kernel does more per vertex: it also
+// stores the view-space point and the outcode, which the edge stage and
+// the near-plane clip would otherwise recompute per edge.
+static void report_transform_scaling(void) {
+    static const int sizes[] = { 8, 128, 1024, 4096 };
+    static short x[4096], y[4096], z[4096];
+    static Point3D aos[4096];
+    static Point2D out[4096];
+    static unsigned char codes[4096];
+    static ViewPoint view[4096];
+    const VertexBuffer vb = { out, codes, view };
+    for (int i = 0; i < 4096; i++) {
+        x[i] = aos[i].x = (rand() % 121) - 60;
+        y[i] = aos[i].y = (rand() % 121) - 60;
+        z[i] = aos[i].z = (rand() % 121) - 60;
+    }
+    for (int c = 0; c < 2; c++) {
+        enum CameraType camera = c ? CAMERA_ORTHOGRAPHIC : CAMERA_PERSPECTIVE;
+        const Pipeline* pipe = pipeline_select(camera);
+        for (int s = 0; s < 4; s++) {
+            int n = sizes[s], reps = (1 << 20) / n;
+            Mesh cloud = { n, 0, x, y, z, 0, 0, 0 };
+            unsigned long long ref_ns, new_ns;
+            TIME_BEST(ref_ns, for (int r = 0; r < reps; r++) {
+                SinCos ax = trig_sincos(r * 64), ay = trig_sincos(r * 32);
+                ref_transform_vertices(aos, n, ax.sin, ax.cos, ay.sin, ay.cos, camera, out);
+            });
+            TIME_BEST(new_ns, for (int r = 0; r < reps; r++) {
+                Matrix3 m;
+                matrix_rotate_xy(&m, r * 64, r * 32);
+                transform_mesh(&cloud, &m, pipe, &vb);
+            });
+            double ref_rate = (double)n * reps * 1e6 / ref_ns, new_rate = (double)n * reps * 1e6 / new_ns;
+            printf("transform[%s %4d] %10.0f -> %10.0f vertices/ms (%.2fx)\n", c ? "ortho" : "persp", n, ref_rate, new_rate, new_rate / ref_rate);
+        }
+    }
+    sink = out[0].x;
+}
+
+// Flatten the torus strips back into an edge list for the per-edge paths.
+static int strip_edges(const unsigned short* strips, int num_strips, unsigned short (*edges)[2]) {
+    int n = 0;
+    while (num_strips--) {
+        int count = *strips++;
+        for (int i = 1; i < count; i++, strips++) { edges[n][0] = strips[0]; edges[n][1] = strips[1]; n++; }
+        strips++;
+    }
+    return n;
+}
+
+static void report_micro(void) {
+    static unsigned short torus_edges[NUM_TORUS_EDGES][2];
+    static Point2D points[MICRO_POSES][NUM_TORUS_VERTICES];
+    static unsigned char codes[MICRO_POSES][NUM_TORUS_VERTICES];
+    static ViewPoint view[MICRO_POSES][NUM_TORUS_VERTICES];
+    static VertexBuffer vb[MICRO_POSES];
+    static short lines[MICRO_POSES * NUM_TORUS_EDGES][4];
+    unsigned long long ns, ref_ns;
+    int num_lines = 0, clipped = 0;
+
+    unsigned int mark = arena_mark(ARENA_EWRAM);
+    TIME_BEST(ns, for (int r = 0; r < MICRO_REPS; r++) { arena_release(ARENA_EWRAM, mark); generate_torus(TORUS_MAJOR_SEGMENTS, TORUS_MINOR_SEGMENTS, TORUS_MAJOR_RADIUS, TORUS_MINOR_RADIUS); });
+    printf("%-16s %12llu ns/call\n", "generate_torus", ns / MICRO_REPS);
+    strip_edges(torus_lods[TORUS_LOD_DEFAULT].strips, torus_lods[TORUS_LOD_DEFAULT].num_strips, torus_edges);
+
+    for (int p = 0; p < MICRO_POSES; p++) vb[p] = (VertexBuffer){ points[p], codes[p], view[p] };
+    TIME_BEST(ns, for (int p = 0; p < MICRO_POSES; p++) pose_points(p, CAMERA_PERSPECTIVE, &vb[p]));
+    printf("%-16s %12.2f ns/vertex\n", "transform", (double)ns / (MICRO_POSES * NUM_TORUS_VERTICES));
+
+    // Clip only: per-vertex outcodes from the transform plus Liang-Barsky on
+    // every edge that needs it (no guard band, so every line ends on screen).
+    TIME_BEST(ns, {
+        num_lines = 0; clipped = 0;
+        for (int p = 0; p < MICRO_POSES; p++) {
+            for (int i = 0; i < NUM_TORUS_EDGES; i++) {
+                int a = torus_edges[i][0], b = torus_edges[i][1];
+                int oc0 = codes[p][a], oc1 = codes[p][b];
+                if ((oc0 | oc1) & CLIP_NEAR) continue;
+                if (oc0 & oc1 & CLIP_SCREEN) continue;
+                int x0 = points[p][a].x, y0 = points[p][a].y, x1 = points[p][b].x, y1 = points[p][b].y;
+                if (oc0 | oc1) { clipped++; if (!liang_barsky_clip(&x0, &y0, &x1, &y1)) continue; }
+                lines[num_lines][0] = x0; lines[num_lines][1] = y0; lines[num_lines][2] = x1; lines[num_lines][3] = y1;
+                num_lines++;
+            }
+        }
+    });
+    printf("%-16s %12.2f ns/edge (%d of %d clipped)\n", "clip", (double)ns / (MICRO_POSES * NUM_TORUS_EDGES), clipped, MICRO_POSES * NUM_TORUS_EDGES);
+
+    // Current rasterizer against the per-pixel reference, same lines, same page.
+    static unsigned char ref_page[SCREEN_WIDTH * SCREEN_HEIGHT];
+    clear_screen(0);
+    TIME_BEST(ref_ns, for (int i = 0; i < num_lines; i++) ref_draw_line(lines[i][0], lines[i][1], lines[i][2], lines[i][3], 1 + (i & 7)));
+    memcpy(ref_page, (const void*)back_buffer, sizeof(ref_page));
+    clear_screen(0);
+    TIME_BEST(ns, for (int i = 0; i < num_lines; i++) draw_line(lines[i][0], lines[i][1], lines[i][2], lines[i][3], 1 + (i & 7)));
+    printf("%-16s %12.2f ns/line\n", "ref_draw_line", (double)ref_ns / num_lines);
+    printf("%-16s %12.2f ns/line (%.2fx, %s)\n", "draw_line", (double)ns / num_lines, (double)ref_ns / ns,
+           memcmp(ref_page, (const void*)back_buffer, sizeof(ref_page)) ? "MISMATCH" : "pixel-exact");
+    sink = back_buffer[0];
+
+    // Whole edge stage with and without the guard band: separate edges, the
+    // strips drawn edge by edge (the default variants) and the strips as
+    // polylines (PIPE_STRIPS). Index bytes per edge in brackets.
+    static const char* const edge_modes[3] = { "draw_edges ", "strip_edges", "polylines  " };
+    const Pipeline* strip_pipe = &pipelines[PIPE_NEAR | PIPE_GUARD];
+    static const int guards[] = { 0, GUARD_BAND_DEFAULT, 128 };
+    for (int g = 0; g < 3; g++) {
+        EdgeStats stats;
+        render_set_guard_band(guards[g]);
+        for (int p = 0; p < MICRO_POSES; p++) pose_points(p, CAMERA_PERSPECTIVE, &vb[p]);
+        for (int strips = 0; strips < 3; strips++) {
+            TIME_BEST(ns, {
+                stats = (EdgeStats){ 0, 0, 0, 0, 0 };
+                for (int p = 0; p < MICRO_POSES; p++) {
+                    if (strips == 2) draw_strips(&vb[p], torus_lods[TORUS_LOD_DEFAULT].strips, torus_lods[TORUS_LOD_DEFAULT].num_strips, 1, &stats);
+                    else if (strips) strip_pipe->draw_strips(&vb[p], torus_lods[TORUS_LOD_DEFAULT].strips, torus_lods[TORUS_LOD_DEFAULT].num_strips, 1, &stats);
+                    else draw_edges(&vb[p], torus_edges, NUM_TORUS_EDGES, 1, &stats);
+                }
+            });
+            printf("%s[gb %3d] %8.2f ns/edge [%.1f B] (acc %d, guard %d, clip %d, rej %d)\n", edge_modes[strips], guards[g],
+                   (double)ns / (MICRO_POSES * NUM_TORUS_EDGES), strips ? 2.0 * (NUM_TORUS_EDGES + 2 * torus_lods[TORUS_LOD_DEFAULT].num_strips) / NUM_TORUS_EDGES : 4.0,
+                   stats.accepted, stats.guarded, stats.clipped, stats.rejected);
+        }
+    }
+    render_set_guard_band(GUARD_BAND_DEFAULT);
+
+    // Strips, drawn edge by edge or as open polylines, must leave exactly
+    // the pixels of whole edges.
+    static unsigned char edge_page[SCREEN_WIDTH * SCREEN_HEIGHT];
+    EdgeStats stats;
+    clear_screen(0);
+    for (int p = 0; p < MICRO_POSES; p++) draw_edges(&vb[p], torus_edges, NUM_TORUS_EDGES, 1 + (p & 7), &stats);
+    memcpy(edge_page, (const void*)back_buffer, sizeof(edge_page));
+    for (int strips = 1; strips < 3; strips++) {
+        clear_screen(0);
+        for (int p = 0; p < MICRO_POSES; p++) {
+            if (strips == 2) draw_strips(&vb[p], torus_lods[TORUS_LOD_DEFAULT].strips, torus_lods[TORUS_LOD_DEFAULT].num_strips, 1 + (p & 7), &stats);
+            else strip_pipe->draw_strips(&vb[p], torus_lods[TORUS_LOD_DEFAULT].strips, torus_lods[TORUS_LOD_DEFAULT].num_strips, 1 + (p & 7), &stats);
+        }
+        printf("%-16s %s\n", strips == 2 ? "polylines/edges" : "strips/edges", memcmp(edge_page, (const void*)back_buffer, sizeof(edge_page)) ? "MISMATCH" : "pixel-exact");
+    }
+
+    // Hidden-line removal without and with polylines, and the same check
+    // against drawing only the edges with a front-facing face one by one.
+    static unsigned char front[MICRO_POSES][NUM_TORUS_VERTICES];
+    static unsigned short visible_edges[NUM_TORUS_EDGES][2];
+    const Mesh* torus = &torus_lods[TORUS_LOD_DEFAULT];
+    for (int p = 0; p < MICRO_POSES; p++) vb[p].front = front[p];
+    render_set_hidden_lines(1);
+    for (int poly = 0; poly < 2; poly++) {
+        render_set_polylines(poly);
+        TIME_BEST(ns, {
+            stats = (EdgeStats){ 0, 0, 0, 0, 0 };
+            for (int p = 0; p < MICRO_POSES; p++) draw_mesh(torus, pipeline_select(CAMERA_PERSPECTIVE), &vb[p], 1, &stats);
+        });
+        printf("%-16s %12.2f ns/edge (%d of %d hidden)\n", poly ? "polyline_hidden" : "draw_hidden", (double)ns / (MICRO_POSES * NUM_TORUS_EDGES),
+               stats.hidden, MICRO_POSES * NUM_TORUS_EDGES);
+    }
+    clear_screen(0);
+    for (int p = 0; p < MICRO_POSES; p++) {
+        face_sides(&vb[p], torus->faces, torus->num_faces);
+        int n = 0;
+        for (int i = 0; i < NUM_TORUS_EDGES; i++) {
+            const unsigned short* f = torus->edge_faces[i];
+            if (f[0] != FACE_NONE && !front[p][f[0]] && (f[1] == FACE_NONE || !front[p][f[1]])) continue;
+            visible_edges[n][0] = torus_edges[i][0]; visible_edges[n][1] = torus_edges[i][1]; n++;
+        }
+        draw_edges(&vb[p], visible_edges, n, 1 + (p & 7), &stats);
+    }
+    memcpy(edge_page, (const void*)back_buffer, sizeof(edge_page));
+    for (int poly = 0; poly < 2; poly++) {
+        render_set_polylines(poly);
+        clear_screen(0);
+        for (int p = 0; p < MICRO_POSES; p++) draw_mesh(torus, pipeline_select(CAMERA_PERSPECTIVE), &vb[p], 1 + (p & 7), &stats);
+        printf("%-16s %s\n", poly ? "hidden/polyline" : "hidden/edges", memcmp(edge_page, (const void*)back_buffer, sizeof(edge_page)) ? "MISMATCH" : "pixel-exact");
+    }
+    render_set_polylines(0);
+    render_set_hidden_lines(0);
+    report_transform_scaling();
+}
+
+// A culled instance must have every vertex outside one plane of the view
+// volume; the sphere test may keep invisible ones but never drop visible ones.
+static int check_scene_cull(void) {
+    static Point2D points[MAX_MESH_VERTICES];
+    static unsigned char codes[MAX_MESH_VERTICES];
+    static ViewPoint view[MAX_MESH_VERTICES];
+    const VertexBuffer vb = { points, codes, view };
+    const Mesh* mesh = &torus_lods[0];
+    int culled = 0, bad = 0, trials = 4096;
+    for (int i = 0; i < trials; i++) {
+        enum CameraType camera = (i & 1) ? CAMERA_ORTHOGRAPHIC : CAMERA_PERSPECTIVE;
+        Matrix3 m;
+        matrix_rotate_xy(&m, rand() & 4095, rand() & 4095);
+        m.t[0] = (rand() % 1201) - 600; m.t[1] = (rand() % 801) - 400; m.t[2] = (rand() % 1000) - 100;
+        if (scene_project_radius(mesh, &m, camera) >= 0) continue;
+        culled++;
+        transform_mesh(mesh, &m, pipeline_select(camera), &vb);
+        int out = CLIP_SCREEN, near = 1;
+        for (int v = 0; v < mesh->num_vertices; v++) {
+            if (camera == CAMERA_ORTHOGRAPHIC) { out &= codes[v]; continue; }
+            int x = view[v].x * VIEWER_DISTANCE, y = view[v].y * VIEWER_DISTANCE, z = view[v].z;
+            out &= (x < -z * (SCREEN_WIDTH / 2)) | ((x > z * (SCREEN_WIDTH / 2)) << 1) | ((y < -z * (SCREEN_HEIGHT / 2)) << 2) | ((y > z * (SCREEN_HEIGHT / 2)) << 3);
+            near &= z < NEAR_Z;
+        }
+        if (!out && !(near && camera == CAMERA_PERSPECTIVE)) bad++;
+    }
+    printf("scene cull: %d of %d culled, %s\n", culled, trials, bad ? "VISIBLE CULLED" : "conservative");
+    return bad == 0;
+}
+
+// Every lit pixel of page a has a lit pixel of page b within one pixel.
+static int near_pixels(const unsigned char* a, const unsigned char* b) {
+    for (int y = 0; y < SCREEN_HEIGHT; y++)
+        for (int x = 0; x < SCREEN_WIDTH; x++) {
+            if (!a[y * SCREEN_WIDTH + x]) continue;
+            int found = 0;
+            for (int v = y - 1; v <= y + 1; v++)
+                for (int u = x - 1; u <= x + 1; u++)
+                    found |= v >= 0 && v < SCREEN_HEIGHT && u >= 0 && u < SCREEN_WIDTH && b[v * SCREEN_WIDTH + u];
+            if (!found) return 0;
+        }
+    return 1;
+}
+
+// Vertices just past the near plane and far off axis project tens of
+// thousands of pixels out, beyond a Point2D. Every perspective pipeline
+// must draw the edges from the screen centre to them as the exactly
+// projected segments clipped to the screen, to within a pixel: the clip
+// starts from a point pulled in along the same ray (project_depth).
+static int check_near_range(void) {
+    static const short x[] = { 0, 1500, -1200 }, y[] = { 0, 300, -1400 }, z[] = { 200, NEAR_Z, NEAR_Z + 1 };
+    static const unsigned short edges[][2] = { { 0, 1 }, { 0, 2 } };
+    static unsigned char expected[SCREEN_WIDTH * SCREEN_HEIGHT];
+    Point2D points[3];
+    unsigned char codes[3];
+    ViewPoint view[3];
+    const VertexBuffer vb = { points, codes, view };
+    const unsigned char* page = (const unsigned char*)back_buffer;
+    Matrix3 m;
+    matrix_rotate_xy(&m, 0, 0);
+    m.t[2] = 0;
+    clear_screen(0);
+    for (int e = 0; e < 2; e++) {
+        int b = edges[e][1];
+        double dx = (double)x[b] * VIEWER_DISTANCE / z[b], dy = (double)y[b] * VIEWER_DISTANCE / z[b];
+        double tx = (dx > 0 ? SCREEN_X_MAX - SCREEN_WIDTH / 2 : SCREEN_X_MIN - SCREEN_WIDTH / 2) / dx;
+        double ty = (dy > 0 ? SCREEN_Y_MAX - SCREEN_HEIGHT / 2 : SCREEN_Y_MIN - SCREEN_HEIGHT / 2) / dy;
+        double t = tx < ty ? tx : ty;
+        draw_line(SCREEN_WIDTH / 2, SCREEN_HEIGHT / 2, SCREEN_WIDTH / 2 + (int)lround(t * dx), SCREEN_HEIGHT / 2 + (int)lround(t * dy), 1);
+    }
+    memcpy(expected, page, sizeof(expected));
+    int bad = 0;
+    for (int i = 0; i < NUM_PIPELINES; i++) {
+        const Pipeline* pipe = &pipelines[i];
+        if (!(pipe->flags & PIPE_NEAR)) continue;
+        EdgeStats stats = { 0 };
+        clear_screen(0);
+        transform_kernels[pipe->flags & (PIPE_NEAR | PIPE_GUARD)](x, y, z, 3, &m, &vb);
+        pipe->draw_edges(&vb, edges, 2, 1, &stats);
+        bad += !near_pixels(page, expected) || !near_pixels(expected, page);
+    }
+    printf("near range: screen (%d, %d) and (%d, %d), %s\n", points[1].x, points[1].y, points[2].x, points[2].y, bad ? "WRONG EDGES" : "edges match");
+    return bad == 0;
+}
+
+// Flip scheduler under simulated frame costs of 0.4, 1.3 and 2.2 frames:
+// no flip outside VBlank, locked paces show every frame no more often than
+// their interval allows, and uncapped never waits.
+static int check_pacing(void) {
+    static const char* const names[NUM_PACINGS] = { "60", "30", "uncapped" };
+    static const int tenths[] = { 4, 13, 22 };
+    const int frames = 120;
+    int ok = 1;
+    for (int p = 0; p < NUM_PACINGS; p++) {
+        for (int c = 0; c < 3; c++) {
+            plat_init();
+            present_init();
+            present_set_pacing(p);
+            for (int f = 0; f < frames; f++) {
+                host_advance(TICKS_PER_FRAME / 10 * tenths[c]);
+                present_frame();
+            }
+            const PresentStats* s = &present_stats;
+            int good = host_tear_count() == 0 && s->shown <= s->vblanks;
+            if (p == PACE_UNCAPPED) good &= s->waits == 0 && s->shown + s->dropped >= s->presented - 1;
+            else good &= s->dropped == 0 && s->shown >= s->presented - 1;
+            if (p == PACE_30) good &= s->vblanks >= 2 * s->shown - 1;
+            if (p == PACE_60 && tenths[c] < 10) good &= s->shown + 2 >= s->vblanks;
+            printf("pace[%-8s %d.%d] %3u shown in %3u vblanks, %3u dropped, %3u waits%s\n", names[p], tenths[c] / 10, tenths[c] % 10,
+                   s->shown, s->vblanks, s->dropped, s->waits, good ? "" : ", BAD");
+            ok &= good;
+        }
+    }
+    return ok;
+}
+
+// Every framebuffer backend renders the same poses of the cube, the torus
+// and the dense 32x16 torus (incremental clear, draw, present into VRAM
+// page 1), as wireframes and then solid, and must leave the same pixels as
+// FB_VRAM. Drawing and present are
+// timed apart; the host has no VRAM wait states, so the GBA trade-off
+// between per-pixel read-modify-writes and one bulk copy shows up only in
+// part. rows/frame is what FB_ROWS saves on the copy.
+static int check_backends(void) {
+    static const char* const mesh_names[] = { "cube", "torus", "dense" };
+    const Mesh* meshes[] = { &cube_mesh, &torus_lods[TORUS_LOD_DEFAULT], &torus_lods[0] };
+    static Point2D points[MAX_MESH_VERTICES];
+    static unsigned char codes[MAX_MESH_VERTICES];
+    static ViewPoint view[MAX_MESH_VERTICES];
+    static unsigned char front[MAX_MESH_FACES];
+    static int depth[MAX_MESH_FACES];
+    static unsigned short order[MAX_MESH_FACES];
+    const VertexBuffer vb = { points, codes, view, front, depth, order };
+    const int laps = 4;
+    int ok = 1;
+    plat_init();
+    present_init();
+    clear_set_mode(CLEAR_DIRTY);
+    for (int k = 0; k < 6; k++) {
+        int m = k % 3;
+        char name[16];
+        render_set_solid(k >= 3);
+        snprintf(name, sizeof(name), "%s%s", mesh_names[m], solid_fill ? " solid" : "");
+        unsigned int expect = 0;
+        for (int b = 0; b < NUM_FB_BACKENDS; b++) {
+            fb_set_backend(b);
+            const Pipeline* pipe = pipeline_select(CAMERA_PERSPECTIVE);
+            unsigned long long draw_ns = 0, present_ns = 0, copied = host_copied_words();
+            unsigned int hash = 0;
+            EdgeStats stats = { 0 };
+            for (int lap = 0; lap < laps; lap++) {
+                for (int p = 0; p < MICRO_POSES; p++) {
+                    Matrix3 mat;
+                    matrix_rotate_xy(&mat, p * 64, p * 32);
+                    transform_mesh(meshes[m], &mat, pipe, &vb);
+                    unsigned long long t0 = host_now_ns();
+                    clear_frame(0);
+                    clear_mark_vertices(&vb, meshes[m]->num_vertices);
+                    draw_mesh(meshes[m], pipe, &vb, 1 + (p & 7), &stats);
+                    unsigned long long t1 = host_now_ns();
+                    if (fb->present) fb->present(1);
+                    unsigned long long t2 = host_now_ns();
+                    draw_ns += t1 - t0; present_ns += t2 - t1;
+                    if (lap == 0) hash = hash * 31 + host_hash_page(host_vram_page(1));
+                }
+            }
+            if (b == FB_VRAM) expect = hash;
+            int frames = laps * MICRO_POSES;
+            printf("fb[%-4s] %-12s %8llu ns draw %8llu ns present %6.1f rows/frame%s\n", fb->name, name, draw_ns / frames, present_ns / frames,
+                   (double)(host_copied_words() - copied) / (SCREEN_WIDTH / 4) / frames, hash == expect ? "" : ", MISMATCH");
+            ok &= hash == expect;
+        }
+    }
+    fb_set_backend(FB_DEFAULT);
+    clear_set_mode(CLEAR_DEFAULT);
+    render_set_solid(0);
+    return ok;
+}
+
+// Every specialized pipeline on the torus poses: transform and edge stage
+// time per frame, and the pixels. With no guard band the eight variants of
+// a camera must draw alike, and at any band each variant must match its
+// VRAM twin that draws strips edge by edge.
+static int check_pipelines(void) {
+    static Point2D points[NUM_TORUS_VERTICES];
+    static unsigned char codes[NUM_TORUS_VERTICES];
+    static ViewPoint view[NUM_TORUS_VERTICES];
+    const VertexBuffer vb = { points, codes, view };
+    const Mesh* torus = &torus_lods[TORUS_LOD_DEFAULT];
+    static const int guards[] = { 0, GUARD_BAND_DEFAULT };
+    int ok = 1;
+    for (int g = 0; g < 2; g++) {
+        unsigned int hashes[NUM_PIPELINES];
+        render_set_guard_band(guards[g]);
+        for (int i = 0; i < NUM_PIPELINES; i++) {
+            const Pipeline* pipe = &pipelines[i];
+            unsigned long long transform_ns = 0, edge_ns = 0;
+            EdgeStats stats = { 0 };
+            clear_screen(0);
+            for (int p = 0; p < MICRO_POSES; p++) {
+                Matrix3 m;
+                matrix_rotate_xy(&m, p * 64, p * 32);
+                m.t[0] = (p & 3) * 48 - 72; // Walk the torus across the screen edges
+                unsigned long long t0 = host_now_ns();
+                transform_mesh(torus, &m, pipe, &vb);
+                unsigned long long t1 = host_now_ns();
+                draw_mesh(torus, pipe, &vb, 1 + (p & 7), &stats);
+                unsigned long long t2 = host_now_ns();
+                transform_ns += t1 - t0; edge_ns += t2 - t1;
+            }
+            hashes[i] = host_hash_page((const unsigned char*)back_buffer);
+            int twin = g ? i & ~(PIPE_BYTES | PIPE_STRIPS) : i & PIPE_NEAR;
+            int match = hashes[i] == hashes[twin];
+            printf("pipe[%-24s gb %3d] %7llu ns transform %7llu ns edges (guard %d, clip %d)%s\n", pipe->name, guards[g],
+                   transform_ns / MICRO_POSES, edge_ns / MICRO_POSES, stats.guarded, stats.clipped, match ? "" : ", MISMATCH");
+            ok &= match;
+        }
+    }
+    render_set_guard_band(GUARD_BAND_DEFAULT);
+    return ok;
+}
+
+// Where convex polygons meet, the fill must cover every pixel exactly once:
+// random convex polygons, some reaching off screen, must fill the same
+// pixels as the triangles of their fan, none of those twice, and wound the
+// other way nothing at all. The depth sort must return every key but the
+// skipped ones, out of order by less than one bucket.
+static int check_solid(void) {
+    static unsigned char hits[SCREEN_WIDTH * SCREEN_HEIGHT];
+    const unsigned char* page = (const unsigned char*)back_buffer;
+    int ok = 1, polygons = 0, pixels = 0;
+    plat_init();
+    present_init();
+    fb_set_backend(FB_DMA);
+    for (int t = 0; t < 2000; t++) {
+        // Up to 8 vertices on a circle at least 45 degrees apart, so rounding
+        // to whole pixels cannot make the polygon concave.
+        int cx = rand() % 320 - 40, cy = rand() % 240 - 40, r = 20 + rand() % 140, phase = rand() % TRIG_ANGLES;
+        int xs[8], ys[8], n = 0, area = 0;
+        for (int slot = 0; slot < 8; slot++) {
+            if (rand() % 8 >= 5) continue;
+            SinCos sc = trig_sincos(phase + slot * (TRIG_ANGLES / 8));
+            xs[n] = cx + ((r * sc.cos) >> FIXED_SHIFT); ys[n] = cy + ((r * sc.sin) >> FIXED_SHIFT); n++;
+        }
+        if (n < 3) continue;
+        for (int i = 0, j = n - 1; i < n; j = i++) area += xs[j] * ys[i] - xs[i] * ys[j];
+        for (int i = 0; area > 0 && i < n / 2; i++) {
+            int x = xs[i], y = ys[i];
+            xs[i] = xs[n - 1 - i]; ys[i] = ys[n - 1 - i]; xs[n - 1 - i] = x; ys[n - 1 - i] = y;
+        }
+        memset(hits, 0, sizeof(hits));
+        for (int i = 1; i + 1 < n; i++) {
+            int tx[3] = { xs[0], xs[i], xs[i + 1] }, ty[3] = { ys[0], ys[i], ys[i + 1] };
+            fb->clear(0);
+            fb->fill(tx, ty, 3, 1);
+            for (int p = 0; p < SCREEN_WIDTH * SCREEN_HEIGHT; p++) hits[p] += page[p] != 0;
+        }
+        fb->clear(0);
+        fb->fill(xs, ys, n, 1);
+        for (int p = 0; p < SCREEN_WIDTH * SCREEN_HEIGHT; p++) { ok &= hits[p] == (page[p] != 0); pixels += page[p] != 0; }
+        int rx[8], ry[8];
+        for (int i = 0; i < n; i++) { rx[i] = xs[n - 1 - i]; ry[i] = ys[n - 1 - i]; }
+        fb->clear(0);
+        fb->fill(rx, ry, n, 1);
+        for (int p = 0; p < SCREEN_WIDTH * SCREEN_HEIGHT; p++) ok &= page[p] == 0;
+        polygons++;
+    }
+    printf("fill: %d polygons, %d pixels: %s\n", polygons, pixels, ok ? "no gaps, no overlaps" : "FAILED");
+
+    static int keys[4096];
+    static unsigned short order[4096];
+    int sorted = 1;
+    for (int t = 0; t < 100; t++) {
+        int n = 1 + rand() % 4096, range = 1 + rand() % 100000, kept = 0, shift = 0;
+        for (int i = 0; i < n; i++) { keys[i] = (rand() % 8) ? rand() % range - range / 2 : DEPTH_SKIP; kept += keys[i] != DEPTH_SKIP; }
+        int count = depth_sort(keys, n, order);
+        while ((range >> shift) >= DEPTH_BUCKETS) shift++;
+        static unsigned char seen[4096];
+        memset(seen, 0, sizeof(seen));
+        sorted &= count == kept;
+        for (int i = 0; i < count; i++) {
+            sorted &= keys[order[i]] != DEPTH_SKIP && !seen[order[i]];
+            seen[order[i]] = 1;
+            if (i > 0) sorted &= keys[order[i]] - keys[order[i - 1]] < (1 << shift);
+        }
+    }
+    printf("depth_sort: %s\n", sorted ? "ok" : "FAILED");
+    fb_set_backend(FB_DEFAULT);
+    return ok && sorted;
+}
+
+// stack_paint() must stop short of static data: an initialized global (in
+// .data, which the GBA linker script places after .bss) keeps its value.
+#define STACK_SENTINEL 0x5E471E1Eu
+static volatile unsigned int stack_sentinel = STACK_SENTINEL;
+static int check_stack(void) {
+    stack_paint();
+    unsigned int used = stack_used(), size = stack_size();
+    int intact = stack_sentinel == STACK_SENTINEL;
+    printf("stack paint: %u bytes painted, %u used, sentinel %s\n", size, used, intact ? "intact" : "OVERWRITTEN");
+    return intact && size && used <= size;
+}
+
+// Rebuilding the torus above a mark must not grow the EWRAM arena, a torus
+// too large for it must fail cleanly, and vertex buffers too large for the
+// IWRAM arena must spill into EWRAM until the frame is reset.
+static int check_arena(void) {
+    // Through demo_init(), above whatever mesh_init() left in the arena:
+    // UP's finest torus and the sweep's must fit, and the default return.
+    demo_init();
+    unsigned int demo_used = arenas[ARENA_EWRAM].used;
+    int ok = demo_set_torus(48, 24) && demo_set_torus(64, 32);
+    ok &= demo_set_torus(TORUS_MAJOR_SEGMENTS, TORUS_MINOR_SEGMENTS) && arenas[ARENA_EWRAM].used == demo_used;
+
+    arena_reset();
+    unsigned int mark = arena_mark(ARENA_EWRAM);
+    ok &= generate_torus(TORUS_MAJOR_SEGMENTS, TORUS_MINOR_SEGMENTS, TORUS_MAJOR_RADIUS, TORUS_MINOR_RADIUS);
+    unsigned int used = arenas[ARENA_EWRAM].used;
+    for (int i = 0; i < 4; i++) {
+        arena_release(ARENA_EWRAM, mark);
+        ok &= generate_torus(48 - 8 * i, 24 - 4 * i, TORUS_MAJOR_RADIUS, TORUS_MINOR_RADIUS);
+    }
+    arena_release(ARENA_EWRAM, mark);
+    ok &= generate_torus(TORUS_MAJOR_SEGMENTS, TORUS_MINOR_SEGMENTS, TORUS_MAJOR_RADIUS, TORUS_MINOR_RADIUS) && arenas[ARENA_EWRAM].used == used;
+    arena_release(ARENA_EWRAM, mark);
+    ok &= !generate_torus(128, 64, TORUS_MAJOR_RADIUS, TORUS_MINOR_RADIUS) && arenas[ARENA_EWRAM].used == mark && torus_lods[0].num_vertices == 0;
+
+    VertexBuffer small, large;
+    arena_frame_reset();
+    ok &= vertex_buffer_alloc(&small, MAX_MESH_VERTICES, MAX_MESH_FACES) && vertex_buffer_alloc(&large, 4 * MAX_MESH_VERTICES, 4 * MAX_MESH_FACES);
+    ok &= (unsigned char*)small.screen >= arenas[ARENA_IWRAM].base && (unsigned char*)small.screen < arenas[ARENA_IWRAM].base + arenas[ARENA_IWRAM].size;
+    ok &= (unsigned char*)large.screen >= arenas[ARENA_EWRAM].base && (unsigned char*)large.screen < arenas[ARENA_EWRAM].base + arenas[ARENA_EWRAM].size;
+    arena_frame_reset();
+    ok &= arenas[ARENA_IWRAM].frame_used == 0 && arenas[ARENA_EWRAM].frame_used == 0;
+    for (int r = 0; r < NUM_ARENAS; r++) {
+        printf("arena[%s] high water %6u of %6u bytes\n", r == ARENA_IWRAM ? "iwram" : "ewram", arenas[r].high_water, arenas[r].size);
+    }
+    printf("arena: rebuild, overflow and spill %s\n", ok ? "ok" : "FAILED");
+    return ok;
+}
+
+// Undirected edges of a mesh's strips, sorted, for comparing meshes whose
+// strips were cut differently (u8 strips end every 254 edges).
+static int compare_edge(const void* pa, const void* pb) {
+    const unsigned short* a = pa; const unsigned short* b = pb;
+    return a[0] != b[0] ? a[0] - b[0] : a[1] - b[1];
+}
+
+static int sorted_edges(const Mesh* mesh, unsigned short (*edges)[2]) {
+    int n = 0;
+    const unsigned short* s16 = mesh->strips;
+    const unsigned char* s8 = mesh->strips8;
+    for (int k = 0; k < mesh->num_strips; k++) {
+        int count = s16 ? *s16++ : *s8++;
+        int prev = s16 ? *s16++ : *s8++;
+        for (int i = 1; i < count; i++) {
+            int next = s16 ? *s16++ : *s8++;
+            edges[n][0] = prev < next ? prev : next; edges[n][1] = prev < next ? next : prev;
+            prev = next; n++;
+        }
+    }
+    qsort(edges, n, sizeof(*edges), compare_edge);
+    return n;
+}
+
+static int same_mesh(const Mesh* a, const Mesh* b) {
+    static unsigned short edges_a[FACE_NONE][2], edges_b[FACE_NONE][2];
+    int nv = a->num_vertices;
+    if (nv != b->num_vertices || a->num_edges != b->num_edges || a->num_faces != b->num_faces || a->radius != b->radius) return 0;
+    if (memcmp(a->x, b->x, nv * sizeof(short)) || memcmp(a->y, b->y, nv * sizeof(short)) || memcmp(a->z, b->z, nv * sizeof(short))) return 0;
+    if (a->num_faces && memcmp(a->faces, b->faces, a->num_faces * sizeof(*a->faces))) return 0;
+    int n = sorted_edges(a, edges_a);
+    return n == a->num_edges && sorted_edges(b, edges_b) == n && !memcmp(edges_a, edges_b, n * sizeof(*edges_a));
+}
+
+// objconv stores the cube with a coordinate shift (its corners are whole
+// model units, so nothing is rounded). Transformed under any pose it must
+// land exactly where its model-unit coordinates do.
+static int check_mesh_shift(void) {
+    static short x[MAX_MESH_VERTICES], y[MAX_MESH_VERTICES], z[MAX_MESH_VERTICES];
+    static Point2D points[2][MAX_MESH_VERTICES];
+    static unsigned char codes[2][MAX_MESH_VERTICES];
+    static ViewPoint view[2][MAX_MESH_VERTICES];
+    const Mesh* cube = &cube_mesh;
+    Mesh plain = *cube;
+    for (int i = 0; i < cube->num_vertices; i++) { x[i] = cube->x[i] >> cube->shift; y[i] = cube->y[i] >> cube->shift; z[i] = cube->z[i] >> cube->shift; }
+    plain.x = x; plain.y = y; plain.z = z; plain.shift = 0;
+    int bad = 0;
+    for (int p = 0; p < 64; p++) {
+        Matrix3 m;
+        matrix_rotate_xy(&m, p * 64, p * 32);
+        matrix_scale(&m, (1 << FIXED_SHIFT) + p * 16);
+        for (int c = 0; c < 2; c++) {
+            const Pipeline* pipe = pipeline_select(c ? CAMERA_ORTHOGRAPHIC : CAMERA_PERSPECTIVE);
+            const VertexBuffer a = { points[0], codes[0], view[0] }, b = { points[1], codes[1], view[1] };
+            transform_mesh(cube, &m, pipe, &a);
+            transform_mesh(&plain, &m, pipe, &b);
+            bad += memcmp(points[0], points[1], cube->num_vertices * sizeof(Point2D)) || memcmp(view[0], view[1], cube->num_vertices * sizeof(ViewPoint)) ||
+                   memcmp(codes[0], codes[1], cube->num_vertices);
+        }
+    }
+    printf("mesh shift: cube stored << %d, %s\n", cube->shift, cube->shift && !bad ? "transforms match" : "MISMATCH");
+    return cube->shift && !bad;
+}
+
+// Every mesh baked by tools/meshgen must match what the runtime generator
+// builds from the same parameters: vertices, faces, radius and edge set.
+// Also reports what the baked meshes save at boot.
+static int check_surfaces(void) {
+    static const unsigned int* const torus_blobs[NUM_TORUS_LODS] = { torus_lod0_blob, torus_lod1_blob, torus_lod2_blob };
+    static const unsigned int* const blobs[NUM_SURFACES] = { 0, sphere_blob, cylinder_blob, grid_blob, mobius_blob };
+    const SurfaceParams* tp = &surface_params[SURFACE_TORUS];
+    int ok = 1, count = 0;
+    arena_reset();
+    for (int lod = 0; lod < NUM_TORUS_LODS; lod++) {
+        Mesh baked, runtime;
+        ok &= mesh_load(&baked, torus_blobs[lod]) && mesh_generate(&runtime, SURFACE_TORUS, tp->u >> lod, tp->v >> lod, tp->a, tp->b);
+        if (!same_mesh(&baked, &runtime)) { printf("surface torus lod %d: baked mesh differs from runtime\n", lod); ok = 0; }
+        count++;
+    }
+    for (int t = SURFACE_TORUS + 1; t < NUM_SURFACES; t++) {
+        const SurfaceParams* p = &surface_params[t];
+        Mesh baked, runtime;
+        ok &= mesh_load(&baked, blobs[t]) && mesh_generate(&runtime, t, p->u, p->v, p->a, p->b);
+        if (!same_mesh(&baked, &runtime)) { printf("surface %s: baked mesh differs from runtime\n", surface_names[t]); ok = 0; }
+        count++;
+    }
+
+    // Boot cost of the default meshes either way.
+    unsigned long long load_ns, generate_ns;
+    unsigned int generated_bytes = 0;
+    TIME_BEST(load_ns, for (int r = 0; r < MICRO_REPS; r++) {
+        for (int lod = 0; lod < NUM_TORUS_LODS; lod++) mesh_load(&torus_lods[lod], torus_blobs[lod]);
+        for (int t = SURFACE_TORUS + 1; t < NUM_SURFACES; t++) mesh_load(&surface_meshes[t], blobs[t]);
+    });
+    TIME_BEST(generate_ns, for (int r = 0; r < MICRO_REPS; r++) {
+        arena_reset();
+        generate_torus(tp->u, tp->v, tp->a, tp->b);
+        for (int t = SURFACE_TORUS + 1; t < NUM_SURFACES; t++) {
+            const SurfaceParams* p = &surface_params[t];
+            mesh_generate(&surface_meshes[t], t, p->u, p->v, p->a, p->b);
+        }
+        generated_bytes = arenas[ARENA_EWRAM].used;
+    });
+    arena_reset();
+    printf("surfaces: baked %8llu ns, 0 bytes RAM; generated %8llu ns, %u bytes EWRAM\n",
+           load_ns / MICRO_REPS, generate_ns / MICRO_REPS, generated_bytes);
+    printf("surfaces: %d baked meshes %s\n", count, ok ? "match the runtime generator" : "MISMATCH");
+    return ok;
+}
+
+// Every frame of the baked ripple, decoded by transform_pose through an
+// identity orthographic transform, must be the surface_ripple() pose to
+// within the frame's delta rounding and inside the mesh's bounding sphere.
+// Then the streamed decode is timed against transforming the same number
+// of plain vertices, and its ROM size against every pose stored whole.
+static int check_anim(void) {
+    static Point2D points[RIPPLE_MAJOR_SEGMENTS * RIPPLE_MINOR_SEGMENTS];
+    static unsigned char codes[RIPPLE_MAJOR_SEGMENTS * RIPPLE_MINOR_SEGMENTS];
+    static ViewPoint view[RIPPLE_MAJOR_SEGMENTS * RIPPLE_MINOR_SEGMENTS];
+    static short x[RIPPLE_MAJOR_SEGMENTS * RIPPLE_MINOR_SEGMENTS], y[RIPPLE_MAJOR_SEGMENTS * RIPPLE_MINOR_SEGMENTS], z[RIPPLE_MAJOR_SEGMENTS * RIPPLE_MINOR_SEGMENTS];
+    const VertexBuffer vb = { points, codes, view };
+    const Matrix3 identity = { { { 1 << FIXED_SHIFT, 0, 0 }, { 0, 1 << FIXED_SHIFT, 0 }, { 0, 0, 1 << FIXED_SHIFT } }, { 0, 0, 0 } };
+    int n = ripple.num_vertices, ok = 1, keys = 0, max_error = 0;
+    if (n != RIPPLE_MAJOR_SEGMENTS * RIPPLE_MINOR_SEGMENTS || ripple_mesh.num_vertices != n || ripple.num_frames != RIPPLE_FRAMES) {
+        printf("anim: ripple is not %dx%d in %d frames\n", RIPPLE_MAJOR_SEGMENTS, RIPPLE_MINOR_SEGMENTS, RIPPLE_FRAMES);
+        return 0;
+    }
+    for (int f = 0; f < ripple.num_frames; f++) {
+        AnimPose pose;
+        anim_pose(&ripple, f, &pose);
+        keys += !pose.dx;
+        transform_pose(&pose, n, &identity, pipeline_select(CAMERA_ORTHOGRAPHIC), &vb);
+        surface_ripple(RIPPLE_MAJOR_SEGMENTS, RIPPLE_MINOR_SEGMENTS, RIPPLE_MAJOR_RADIUS, RIPPLE_MINOR_RADIUS,
+                       RIPPLE_AMPLITUDE, RIPPLE_WAVES, f * TRIG_ANGLES / RIPPLE_FRAMES, x, y, z);
+        for (int i = 0; i < n; i++) {
+            int e = abs(view[i].x - x[i]) | abs(view[i].y - y[i]) | abs(view[i].z - z[i]);
+            if (e > max_error) max_error = e;
+            ok &= 2 * abs(view[i].x - x[i]) <= (1 << pose.shift) && 2 * abs(view[i].y - y[i]) <= (1 << pose.shift) && 2 * abs(view[i].z - z[i]) <= (1 << pose.shift);
+            ok &= view[i].x * view[i].x + view[i].y * view[i].y + view[i].z * view[i].z <= ripple_mesh.radius * ripple_mesh.radius;
+        }
+    }
+
+    unsigned long long pose_ns, mesh_ns;
+    Matrix3 m;
+    matrix_rotate_xy(&m, 300, 200);
+    const Pipeline* pipe = pipeline_select(CAMERA_PERSPECTIVE);
+    TIME_BEST(pose_ns, for (int f = 0; f < ripple.num_frames; f++) { AnimPose pose; anim_pose(&ripple, f, &pose); transform_pose(&pose, n, &m, pipe, &vb); });
+    TIME_BEST(mesh_ns, for (int f = 0; f < ripple.num_frames; f++) transform_mesh(&ripple_mesh, &m, pipe, &vb));
+    const AnimBlobHeader* h = (const AnimBlobHeader*)ripple_anim;
+    printf("anim: %d frames, %d keyframes, %u bytes ROM (%d as whole poses), 0 bytes RAM, max error %d\n",
+           ripple.num_frames, keys, h->size, ripple.num_frames * n * 6, max_error);
+    printf("anim: transform_pose %6.2f ns/vertex, transform_mesh %6.2f ns/vertex\n",
+           (double)pose_ns / (ripple.num_frames * n), (double)mesh_ns / (ripple.num_frames * n));
+    printf("anim: decoded poses %s\n", ok ? "match surface_ripple" : "MISMATCH");
+    return ok;
+}
+
+static void emit_golden(const unsigned int* hashes, int frames) {
+    printf("#ifndef GOLDEN_H\n#define GOLDEN_H\n\n");
+    printf("// Per-frame FNV-1a hashes of the presented Mode 4 page for the scripted\n");
+    printf("// host run in host/bench.c. Regenerate with `make golden`.\n");
+    printf("#define GOLDEN_FRAMES %d\n", frames);
+    printf("static const unsigned int golden_hashes[GOLDEN_FRAMES] = {\n");
+    for (int f = 0; f < frames; f++) printf("%s0x%08X,%s", (f % 8) ? " " : "    ", hashes[f], (f % 8 == 7 || f == frames - 1) ? "\n" : "");
+    printf("};\n\n#endif // GOLDEN_H\n");
+}
+
+static const unsigned int* expected_hashes = golden_hashes;
+
+static int check_golden(const unsigned int* hashes, int frames) {
+    int n = frames < GOLDEN_FRAMES ? frames : GOLDEN_FRAMES, bad = 0;
+    for (int f = 0; f < n; f++) {
+        if (hashes[f] != expected_hashes[f]) {
+            if (bad < 8) printf("frame %d: hash 0x%08X, expected 0x%08X\n", f, hashes[f], expected_hashes[f]);
+            bad++;
+        }
+    }
+    printf("golden: %d/%d frames match\n", n - bad, n);
+    return bad == 0;
+}
+
+// Every clear mode must leave exactly the same frames: a stale pixel from
+// two frames back changes the page hash.
+static int check_clear_modes(int frames, unsigned int* hashes) {
+    int ok = 1;
+    for (int m = 0; m < NUM_CLEAR_MODES; m++) {
+        if (m == CLEAR_DEFAULT) continue;
+        run_frames(frames, hashes, m);
+        printf("clear[%s] %12llu ns/frame, ", clear_mode_names[m], ticks_to_ns(zone_ticks[PROF_CLEAR]) / frames);
+        ok &= check_golden(hashes, frames);
+    }
+    return ok;
+}
+
+// A recording of the scripted run, played back with no keys held, must
+// draw the same frames.
+static int check_replay(int frames) {
+    ReplayFrame* recording = malloc(frames * sizeof(ReplayFrame));
+    unsigned int* recorded = malloc(frames * sizeof(unsigned int));
+    unsigned int* replayed = malloc(frames * sizeof(unsigned int));
+    const ReplayFrame* saved = run_replay;
+    run_replay = 0; run_record = recording;
+    run_frames(frames, recorded, CLEAR_DEFAULT);
+    run_record = 0; run_replay = recording; run_replay_frames = frames;
+    run_frames(frames, replayed, CLEAR_DEFAULT);
+    run_replay = saved;
+    int match = 0;
+    for (int f = 0; f < frames; f++) match += recorded[f] == replayed[f];
+    printf("replay: %d/%d replayed frames match the recording\n", match, frames);
+    free(replayed); free(recorded); free(recording);
+    return match == frames;
+}
+
+// --- Scaling Sweep ---
+// Every torus resolution from 8x4 to 64x32 in both models that draw it,
+// under both cameras. Each run replays the same recorded stretch of the
+// demo's animation, with the model and camera keys pressed during the
+// warm-up frames, which are not counted. Stage times come from the profiler
+// zones and are 0 with PROFILE=0; the frame time is always wall time, and
+// the rates fall back to it. Sizes the EWRAM arena cannot generate are
+// listed as not fitting.
+#define SWEEP_WARMUP 16
+#define SWEEP_FRAMES 128
+static const unsigned char sweep_sizes[][2] = { { 8, 4 }, { 16, 8 }, { 24, 12 }, { 32, 16 }, { 48, 24 }, { 64, 32 } };
+#define NUM_SWEEP_SIZES (int)(sizeof(sweep_sizes) / sizeof(sweep_sizes[0]))
+static const enum ModelType sweep_models[2] = { MODEL_TORUS, MODEL_SCENE };
+static const char* const sweep_model_names[2] = { "torus", "scene" };
+
+static int run_sweep(const char* path) {
+    enum { TOTAL = SWEEP_WARMUP + SWEEP_FRAMES };
+    static ReplayFrame base[TOTAL], script[TOTAL];
+    FILE* f = fopen(path, "w");
+    if (!f) { perror(path); return 0; }
+
+    // The animation every run replays, from a run with no keys pressed.
+    plat_init();
+    demo_init();
+    replay_record(base, TOTAL);
+    for (int i = 0; i < TOTAL; i++) demo_frame();
+    replay_stop();
+
+    fprintf(f, "{\n  \"frames\": %d,\n  \"warmup\": %d,\n  \"profile\": %s,\n  \"runs\": [",
+            SWEEP_FRAMES, SWEEP_WARMUP, PROFILE_ENABLED ? "true" : "false");
+    int runs = 0;
+    for (int s = 0; s < NUM_SWEEP_SIZES; s++) {
+        int major = sweep_sizes[s][0], minor = sweep_sizes[s][1];
+        for (int m = 0; m < 2; m++) {
+            for (int c = 0; c < 2; c++) {
+                // A steps the model on from the cube, B switches to ortho.
+                memcpy(script, base, sizeof(script));
+                for (int k = 0; k < (int)sweep_models[m]; k++) script[2 * k].keys |= KEY_A;
+                if (c) script[2 * sweep_models[m]].keys |= KEY_B;
+                const char* camera = c ? "ortho" : "persp";
+                fprintf(f, "%s\n    { \"model\": \"%s\", \"camera\": \"%s\", \"segments\": [%d, %d], ",
+                        runs++ ? "," : "", sweep_model_names[m], camera, major, minor);
+                plat_init();
+                demo_init();
+                if (!demo_set_torus(major, minor)) {
+                    fprintf(f, "\"fits\": false }");
+                    if (!m && !c) printf("sweep: %dx%d torus does not fit the EWRAM arena\n", major, minor);
+                    continue;
+                }
+                replay_play(script, TOTAL);
+                unsigned long long frame_ns = 0, vertices = 0, edges = 0, zone[NUM_PROF_ZONES] = { 0 };
+                for (int i = 0; i < TOTAL; i++) {
+                    unsigned long long t0 = host_now_ns();
+                    demo_frame();
+                    if (i < SWEEP_WARMUP) continue;
+                    frame_ns += host_now_ns() - t0;
+                    for (int z = 0; z < NUM_PROF_ZONES; z++) zone[z] += prof_sample(0, z);
+                    int n;
+                    EdgeStats st;
+                    demo_work(&n, &st);
+                    vertices += n;
+                    edges += st.accepted + st.guarded + st.clipped + st.rejected + st.hidden;
+                }
+                replay_stop();
+                unsigned long long transform_ns = PROFILE_ENABLED ? ticks_to_ns(zone[PROF_TRANSFORM]) : frame_ns;
+                unsigned long long raster_ns = PROFILE_ENABLED ? ticks_to_ns(zone[PROF_RASTER]) : frame_ns;
+                double vertex_rate = transform_ns ? vertices * 1e9 / transform_ns : 0, edge_rate = raster_ns ? edges * 1e9 / raster_ns : 0;
+                fprintf(f, "\"fits\": true, \"vertices\": %llu, \"edges\": %llu,\n", vertices / SWEEP_FRAMES, edges / SWEEP_FRAMES);
+                fprintf(f, "      \"frame_ns\": %llu, \"stages_ns\": {", frame_ns / SWEEP_FRAMES);
+                for (int z = 1; z < NUM_PROF_ZONES; z++) fprintf(f, "%s\"%s\": %llu", z > 1 ? ", " : " ", prof_zone_names[z], ticks_to_ns(zone[z]) / SWEEP_FRAMES);
+                fprintf(f, " },\n      \"vertices_per_s\": %.0f, \"edges_per_s\": %.0f }", vertex_rate, edge_rate);
+                printf("sweep[%s %s %2dx%-2d] %5llu vertices %5llu edges %8llu ns/frame %7.2f Mvertices/s %7.2f Medges/s\n", sweep_model_names[m], camera,
+                       major, minor, vertices / SWEEP_FRAMES, edges / SWEEP_FRAMES, frame_ns / SWEEP_FRAMES, vertex_rate / 1e6, edge_rate / 1e6);
+            }
+        }
+    }
+    fprintf(f, "\n  ]\n}\n");
+    fclose(f);
+    printf("sweep: %d runs written to %s\n", runs, path);
+    return 1;
+}
+
+int main(int argc, char** argv) {
+    int frames = 0, check = 0, emit = 0;
+    const char* csv = 0, *record = 0, *replay = 0, *sweep = 0;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-n") && i + 1 < argc) frames = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--check")) check = 1;
+        else if (!strcmp(argv[i], "--emit-golden")) emit = 1;
+        else if (!strcmp(argv[i], "--profile-csv") && i + 1 < argc) csv = argv[++i];
+        else if (!strcmp(argv[i], "--record") && i + 1 < argc) record = argv[++i];
+        else if (!strcmp(argv[i], "--replay") && i + 1 < argc) replay = argv[++i];
+        else if (!strcmp(argv[i], "--sweep") && i + 1 < argc) sweep = argv[++i];
+        else {
+            fprintf(stderr, "usage: %s [-n frames] [--check] [--emit-golden] [--profile-csv file] [--record file] [--replay file] [--sweep file]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (sweep) return run_sweep(sweep) ? 0 : 1;
+    ReplayFrame* replay_frames = 0;
+    if (replay) {
+        run_replay_frames = read_replay(replay, &replay_frames);
+        if (run_replay_frames < 0) return 1;
+        run_replay = replay_frames;
+        if (frames <= 0) frames = run_replay_frames;
+    }
+    if (frames <= 0) frames = DEFAULT_FRAMES;
+    if (emit) frames = DEFAULT_FRAMES;
+
+    unsigned int* hashes = malloc(frames * sizeof(unsigned int));
+    ReplayFrame* recording = record ? malloc(frames * sizeof(ReplayFrame)) : 0;
+    run_record = recording;
+    run_frames(frames, hashes, CLEAR_DEFAULT);
+    run_record = 0;
+    unsigned int stack_bytes = stack_used(); // Before anything else digs deeper
+
+    if (emit) { emit_golden(hashes, frames); free(hashes); return 0; }
+    if (record && write_replay(record, recording, frames)) printf("replay: %d frames recorded to %s\n", frames, record);
+
+    // golden.h is recorded from the script with baked meshes. A replay draws
+    // other frames, and generating the meshes at boot changes the HUD's
+    // arena line, so then the clear modes are checked against this run.
+    static unsigned int run_hashes[GOLDEN_FRAMES];
+    if (replay || !BAKED_MESHES) {
+        memcpy(run_hashes, hashes, (frames < GOLDEN_FRAMES ? frames : GOLDEN_FRAMES) * sizeof(unsigned int));
+        expected_hashes = run_hashes;
+        printf("golden: %s, checking clear modes against the default\n", replay ? "replay" : "BAKED_MESHES=0");
+    }
+    if (replay) printf("replay: %d frames from %s\n", run_replay_frames, replay);
+    printf("frames: %d\n", frames);
+    printf("stack: %u bytes high water below run_frames (%u painted)\n", stack_bytes, stack_size());
+    report_zones(frames);
+    if (csv && dump_profile_csv(csv)) printf("profile: %d frames written to %s\n", prof_frames(), csv);
+    printf("clear[%s] %12llu ns/frame, ", clear_mode_names[CLEAR_DEFAULT], ticks_to_ns(zone_ticks[PROF_CLEAR]) / frames);
+    int ok = check_golden(hashes, frames);
+    ok &= check_clear_modes(frames, hashes);
+    if (check) ok &= check_recip();
+    if (check) ok &= check_trig();
+    if (check) ok &= check_scene_cull();
+    if (check) ok &= check_near_range();
+    if (check) ok &= check_pacing();
+    if (check) ok &= check_replay(frames);
+    ok &= check_backends();
+    ok &= check_pipelines();
+    if (check) ok &= check_solid();
+    if (check) ok &= check_arena();
+    if (check) ok &= check_stack();
+    if (check) ok &= check_mesh_shift();
+    if (check) ok &= check_surfaces();
+    if (check) ok &= check_anim();
+    report_micro();
+    free(recording); free(replay_frames); free(hashes);
+    return (check && !ok) ? 1 : 0;
+}
@@ -0,0 +1,70 @@
+#include <stdio.h>
+#include "host.h"
+#include "recip.h"
+#include "render.h"
+
+// Exhaustive accuracy check of the reciprocal table against exact division:
+// the documented error bounds, the perspective projection and the clip
+// parameter divide.
+
+#define RECIP_MAX_D (1u << 24)
+
+static double rel_error(double got, double want) { double e = (got - want) / want; return e < 0 ? -e : e; }
+
+int check_recip(void) {
+    double table_err = 0, norm_err = 0;
+    for (unsigned int d = 1; d < RECIP_MAX_D; d++) {
+        int s;
+        double want = (double)(1u << RECIP_SHIFT) / d;
+        double got = (double)recip_norm(d, &s) / (1u << s);
+        double e = rel_error(got, want);
+        if (d <= RECIP_TABLE_SIZE) { if (e > table_err) table_err = e; }
+        else if (e > norm_err) norm_err = e;
+    }
+
+    // Perspective: every on-screen result for depths up to 4096.
+    int proj_err = 0;
+    for (int z = 1; z <= 4096; z++) {
+        for (int x = -1024; x <= 1024; x++) {
+            long long n = (long long)x * VIEWER_DISTANCE;
+            long long want = n >= 0 ? n / z : -((-n + z - 1) / z); // floor
+            if (want < -SCREEN_WIDTH || want > SCREEN_WIDTH) continue;
+            int e = recip_div(x * VIEWER_DISTANCE, z, 0) - (int)want;
+            if (e < 0) e = -e;
+            if (e > proj_err) proj_err = e;
+        }
+    }
+
+    // Clip parameter t = (q << FIXED_SHIFT) / p over the t range that matters.
+    int clip_err = 0;
+    for (int p = -4096; p <= 4096; p++) {
+        if (p == 0) continue;
+        for (int q = -4096; q <= 4096; q += 7) {
+            long long n = (long long)q << FIXED_SHIFT;
+            double want = (double)n / p;
+            if (want < -(2 << FIXED_SHIFT) || want > (2 << FIXED_SHIFT)) continue;
+            double e = recip_div(q, p, FIXED_SHIFT) - want;
+            if (e < 0) e = -e;
+            if (e > clip_err) clip_err = (int)(e + 0.999);
+        }
+    }
+
+    // The Thumb split multiply must match a 64-bit one bit for bit, extremes included.
+    int mul_bad = 0;
+    unsigned int seed = 1;
+    static const int edge_n[] = { 0, 1, -1, 0x7FFFFFFF, -0x7FFFFFFF - 1, 0xFFFF, -0x10000 };
+    for (int i = 0; i < 1 << 20; i++) {
+        seed = seed * 1103515245u + 12345u;
+        int n = i < 7 ? edge_n[i] : (int)(seed ^ (seed >> 7) * 2654435761u);
+        seed = seed * 1103515245u + 12345u;
+        unsigned int r = (i & 1) ? seed >> 1 : seed >> (1 + (i >> 1) % 31);
+        int k = 1 + i % 63;
+        int want = (int)(((long long)n * r) >> k);
+        mul_bad += recip_mul_shr16(n, r, k) != want;
+    }
+
+    int ok = table_err < 1.0 / (1 << 15) && norm_err < 1.0 / (1 << 13) && proj_err <= 1 && clip_err <= 2 && !mul_bad;
+    printf("recip: table %.2e (< 2^-15), normalized %.2e (< 2^-13), projection %d px, clip t %d/4096, multiply %s: %s\n",
+           table_err, norm_err, proj_err, clip_err, mul_bad ? "MISMATCH" : "exact", ok ? "ok" : "FAIL");
+    return ok;
+}
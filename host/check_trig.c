@@ -0,0 +1,34 @@
+#include <stdio.h>
+#include <math.h>
+#include "host.h"
+#include "trig.h"
+
+// Exhaustive check of the folded quarter-wave lookup against libm: every
+// table angle must be correctly rounded, every fine angle within one unit,
+// and cos must be sin a quarter turn later.
+
+int check_trig(void) {
+    const double two_pi = 6.283185307179586;
+    double step_err = 0, fine_err = 0;
+    int fold_ok = 1;
+    for (unsigned int a = 0; a < TRIG_ANGLES; a++) {
+        SinCos r = trig_sincos(a);
+        double t = two_pi * a / TRIG_ANGLES;
+        double es = fabs(r.sin - 4096 * sin(t)), ec = fabs(r.cos - 4096 * cos(t));
+        if (es > step_err) step_err = es;
+        if (ec > step_err) step_err = ec;
+        if (r.cos != trig_sincos(a + TRIG_QUARTER).sin) fold_ok = 0;
+    }
+    for (unsigned int a = 0; a < (TRIG_ANGLES << TRIG_FINE_BITS); a++) {
+        SinCos r = trig_sincos_fine(a);
+        double t = two_pi * a / (TRIG_ANGLES << TRIG_FINE_BITS);
+        double es = fabs(r.sin - 4096 * sin(t)), ec = fabs(r.cos - 4096 * cos(t));
+        if (es > fine_err) fine_err = es;
+        if (ec > fine_err) fine_err = ec;
+    }
+
+    int ok = step_err <= 0.5 && fine_err <= 1.0 && fold_ok;
+    printf("trig: table %.3f (<= 0.5), interpolated %.3f (<= 1) units of 1/4096, folding %s: %s\n",
+           step_err, fine_err, fold_ok ? "exact" : "BROKEN", ok ? "ok" : "FAIL");
+    return ok;
+}
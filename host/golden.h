@@ -0,0 +1,42 @@
+#ifndef GOLDEN_H
+#define GOLDEN_H
+
+// Per-frame FNV-1a hashes of the presented Mode 4 page for the scripted
+// host run in host/bench.c. Regenerate with `make golden`.
+#define GOLDEN_FRAMES 256
+static const unsigned int golden_hashes[GOLDEN_FRAMES] = {
+    0xA3893D63, 0xBE8FED83, 0x62DE1094, 0x37F202FE, 0x30D558E5, 0x730B4C9B, 0x591B2F37, 0x6E79415B,
+    0x65F0380F, 0x737573EA, 0xDEFDE203, 0x04A47730, 0xA2CF876E, 0xE43F72DA, 0x895A5D2D, 0x9CE187CD,
+    0x3B1168E2, 0x8B039E0E, 0x9410698B, 0xF2DA2F45, 0x0D21B717, 0x38A17A14, 0xC015DE49, 0x998553F9,
+    0xF5B037EF, 0x176276E3, 0x890348FA, 0xDC56E780, 0x23F8F005, 0x943E0AAA, 0xA7129D85, 0x410AD0D4,
+    0x8EFC8867, 0x2F3CD3F5, 0x1B345AF9, 0x2475BB3D, 0x21B611C2, 0xD36483E6, 0x3AAE7EE2, 0xAB25B7BF,
+    0xC76CF834, 0x45160FF6, 0x9C697653, 0x4C0F4BAB, 0x69EE01FA, 0x3B69CD2F, 0x3DA90BA3, 0xC7CA492B,
+    0xB8E47064, 0xDA906044, 0x87977530, 0x6F920C8C, 0xA428E082, 0x3137A07C, 0x30DDA36B, 0x371B18FE,
+    0x2562530F, 0x4028E00E, 0x13DE82B5, 0xA84BEDF6, 0xFE0014DD, 0x4A056917, 0x0F22F76F, 0xC3B66ACA,
+    0x09B6419A, 0xEA9D3F7B, 0x86BDF530, 0x733A795D, 0x9A68E6D3, 0x93E36536, 0x69D76068, 0x5307F220,
+    0x1A857B3C, 0xC84E015E, 0x3564D648, 0x909766C6, 0xB4BC44D6, 0x4BA9D3B5, 0xC86B6E5E, 0xFD124393,
+    0xA4B4B9C0, 0x79D7890D, 0x658DBEEE, 0x850ABA6F, 0x46EE4D72, 0xCDBB137C, 0x76B8E8BA, 0x12242F9E,
+    0xBBFC7FFA, 0xA8688C9C, 0x13089536, 0x2C91DDBF, 0xCEED4847, 0xA90434B0, 0x24F2730E, 0x7175917D,
+    0x647549E1, 0xCDDCCD06, 0x4940722F, 0x066AEF68, 0x575A2CD4, 0x9E72C45A, 0x2C60067E, 0xB3CD7A3D,
+    0xAD3E6AE0, 0xB2D1EA7B, 0x5B4671FA, 0x73BD11EA, 0x07729892, 0xDA721A8E, 0x33ED300A, 0x9AB4DB46,
+    0xFCAC947E, 0xACB05078, 0x40F79B32, 0x94EF8A05, 0x611C70BA, 0xB5BB09C2, 0x4F5522BF, 0x1B79D37D,
+    0x6745BBBD, 0xECA76ACD, 0xCA52592F, 0xB382D627, 0xFF2EB5BE, 0x0903365D, 0x8251F1ED, 0x3E0CF722,
+    0x77AB2E8A, 0x2A54FD1B, 0x911BC303, 0x403070A5, 0x56DFAAFB, 0x211BF2ED, 0x2351C7E8, 0x5105A408,
+    0x1728BAC5, 0xF545A48B, 0xA0A8E19F, 0x3AB11815, 0x79501C5D, 0x634AC0BE, 0x283E30C3, 0x2AF0703E,
+    0x6EAECB58, 0x6A0137D0, 0x0C342AC8, 0x06CB4799, 0x1F720D0D, 0x6C326507, 0x655B3291, 0x8DC8A1D4,
+    0xBA083343, 0xE00846D6, 0x0915C508, 0xA5CE90BF, 0xAFADA602, 0x44C0DFF9, 0xE2BE0D19, 0x5ABB0E8E,
+    0x78E602A8, 0xC304881A, 0xB7FA6ECE, 0xC6F302C3, 0x3A7D4DAA, 0xAD18FF07, 0x92D92BD0, 0xE828B8BB,
+    0xA5C2A2B6, 0xDC264E75, 0xD38FF345, 0x5D27A8B1, 0xB7654C48, 0x8769A83F, 0xE4563356, 0x9DB37DD2,
+    0x8337A1FC, 0xABAFE4BC, 0x11501090, 0x56B51949, 0x4146C505, 0x7E45FBBA, 0xC2D3B5C8, 0xFFD102F2,
+    0x8EF64A0A, 0xB4D2CAE1, 0xAEF5147A, 0x0AA0DF1B, 0xA4DFE3F1, 0x71F8CD16, 0x5B8D09C9, 0xAB15DF72,
+    0x8CFA9C32, 0xBC33FD4B, 0xA5CC6AB0, 0xB8C4A73C, 0xC105F4A1, 0x8CF365C6, 0x5720C48F, 0xB84FF4A7,
+    0x787A87DB, 0x22DDC5C9, 0xEF784725, 0x24FD55FF, 0xF57EBC35, 0xAC1E1A3F, 0x889DEE9D, 0x667F79C8,
+    0x776F2398, 0x965C9967, 0xA19E0C1E, 0x5A143EA2, 0xC4E51C1A, 0x2D11FD39, 0xA16BA1DC, 0x941971DA,
+    0xA4B52CD4, 0xCF3F9F07, 0xE9D55D90, 0x0178BD81, 0x6FF554B0, 0x6C62D6B7, 0x4231B8A8, 0x274EFA3C,
+    0xBAA24649, 0xAA000B00, 0x147C9902, 0x8108A894, 0x697BB77D, 0xE5F5B3F5, 0xA98CBCC8, 0x94C0F5E8,
+    0x273192F0, 0x7629EAA2, 0x0A28B5DB, 0x5798DC30, 0x893A2B78, 0x1F5B3099, 0xCBF2D907, 0x3888F5FE,
+    0x1C7625D0, 0xE3645F85, 0x92F66993, 0xBC9158AB, 0x5F84BF8B, 0x48766C6E, 0xBCB26B49, 0x5E9013F1,
+    0x9533D0A8, 0xCD07A9BD, 0x26C7E607, 0x697D2F9F, 0xD25F9EA5, 0x2D3D179C, 0x590D5A23, 0x58AC39EB,
+};
+
+#endif // GOLDEN_H
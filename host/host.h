@@ -0,0 +1,23 @@
+#ifndef HOST_H
+#define HOST_H
+
+#include "platform.h"
+
+// Host-only hooks into the headless platform backend.
+extern unsigned short host_palette[256];
+
+void host_set_keys(unsigned short keys);
+const unsigned char* host_front_page(void);     // VRAM page on screen
+const unsigned char* host_presented_page(void); // Last frame completed in VRAM
+const unsigned char* host_vram_page(int page);
+unsigned int host_tear_count(void);             // Flips made outside VBlank
+unsigned long long host_copied_words(void);     // By plat_copy_rows, since plat_init
+void host_advance(unsigned int ticks);          // Simulated work; takes VBlanks on the way
+unsigned int host_hash_page(const unsigned char* page);
+unsigned long long host_now_ns(void);
+
+// Host-side accuracy checks run by `make check`.
+int check_recip(void);
+int check_trig(void);
+
+#endif // HOST_H
@@ -0,0 +1,126 @@
+#include <string.h>
+#include <time.h>
+#include "host.h"
+#include "present.h"
+
+// Two in-memory Mode 4 pages standing in for VRAM_PAGE0/1, plus the
+// offscreen page frames are drawn into.
+static unsigned short host_vram[NUM_VRAM_PAGES][VRAM_PAGE_SIZE / 2] __attribute__((aligned(4)));
+static unsigned short host_offscreen[PAGE_BYTES / 2] __attribute__((aligned(4)));
+volatile unsigned short* back_buffer = host_offscreen;
+unsigned short host_palette[256];
+
+static unsigned short host_keys;
+// Simulated cycle counter. Drawing costs nothing; time moves only through
+// the page copy, waits for VBlank and host_advance(), so every value the
+// demo derives from it (and therefore every HUD pixel) is reproducible.
+static unsigned int host_tick_count;
+static int host_shown, host_presented;
+static int host_irq_masked, host_irq_pending, host_irq_flag;
+static unsigned int host_tears;
+static unsigned long long host_copied; // Words copied into VRAM
+
+#define HOST_COPY_WORD_TICKS 7 // DMA3, EWRAM to VRAM
+
+void plat_init(void) {
+    memset(host_vram, 0, sizeof(host_vram));
+    memset(host_offscreen, 0, sizeof(host_offscreen));
+    memset(host_palette, 0, sizeof(host_palette));
+    back_buffer = host_offscreen;
+    host_keys = 0;
+    host_tick_count = 0;
+    host_shown = 0; host_presented = 0;
+    host_irq_masked = 0; host_irq_pending = 0; host_irq_flag = 0;
+    host_tears = 0; host_copied = 0;
+}
+
+void plat_set_palette(int index, unsigned short color) { host_palette[index] = color; }
+int plat_page(void) { return back_buffer == host_vram[1]; }
+void plat_set_target(int vram_page) { back_buffer = vram_page < 0 ? host_offscreen : host_vram[vram_page]; }
+void plat_fill32(volatile void* dst, unsigned int value, int words) { unsigned int* d = (unsigned int*)dst; while (words--) *d++ = value; }
+unsigned int plat_ticks(void) { return host_tick_count; }
+unsigned short plat_keys(void) { return host_keys; }
+
+// The host stack has no fixed end; stack_paint() covers a window this far
+// below its caller, far more than a frame of the demo needs.
+#define HOST_STACK_WINDOW (64 * 1024)
+void* plat_stack_limit(void) { return (char*)__builtin_frame_address(0) - HOST_STACK_WINDOW; }
+
+// --- Display ---
+// The VBlank interrupt is raised at the start of line VBLANK_LINE of every
+// frame; while masked it stays pending until plat_irq_unlock().
+static void host_vblank_irq(void) {
+    if (host_irq_masked) { host_irq_pending = 1; return; }
+    present_vblank();
+    host_irq_flag = 1;
+}
+
+static unsigned int host_next_vblank(void) {
+    unsigned int t = host_tick_count / TICKS_PER_FRAME * TICKS_PER_FRAME + VBLANK_LINE * SCANLINE_TICKS;
+    return t <= host_tick_count ? t + TICKS_PER_FRAME : t;
+}
+
+void host_advance(unsigned int ticks) {
+    unsigned int end = host_tick_count + ticks;
+    for (unsigned int t = host_next_vblank(); t <= end; t = host_next_vblank()) {
+        host_tick_count = t;
+        host_vblank_irq();
+    }
+    host_tick_count = end;
+}
+
+volatile unsigned short* plat_vram_page(int vram_page) { return host_vram[vram_page]; }
+
+void plat_copy_rows(int vram_page, int y0, int y1) {
+    memcpy((unsigned char*)host_vram[vram_page] + y0 * SCREEN_WIDTH, (unsigned char*)host_offscreen + y0 * SCREEN_WIDTH, (y1 - y0 + 1) * SCREEN_WIDTH);
+    host_presented = vram_page;
+    host_copied += (y1 - y0 + 1) * (SCREEN_WIDTH / 4);
+    host_advance((y1 - y0 + 1) * (SCREEN_WIDTH / 4) * HOST_COPY_WORD_TICKS);
+}
+
+// A page is only shown after its frame is complete, so it is also the
+// latest presented one.
+void plat_show_page(int vram_page) {
+    if (plat_vcount() < VBLANK_LINE && host_tick_count) host_tears++;
+    host_shown = vram_page;
+    host_presented = vram_page;
+}
+
+void plat_wait_vblank(void) {
+    if (!host_irq_flag) host_advance(host_next_vblank() - host_tick_count);
+    host_irq_flag = 0;
+}
+
+void plat_irq_lock(void) { host_irq_masked = 1; }
+void plat_irq_unlock(void) {
+    host_irq_masked = 0;
+    if (host_irq_pending) { host_irq_pending = 0; host_vblank_irq(); }
+}
+
+unsigned int plat_vcount(void) { return host_tick_count % TICKS_PER_FRAME / SCANLINE_TICKS; }
+
+// --- Host Hooks ---
+void host_set_keys(unsigned short keys) { host_keys = keys; }
+const unsigned char* host_front_page(void) { return (const unsigned char*)host_vram[host_shown]; }
+const unsigned char* host_presented_page(void) { return (const unsigned char*)host_vram[host_presented]; }
+const unsigned char* host_vram_page(int page) { return (const unsigned char*)host_vram[page]; }
+unsigned int host_tear_count(void) { return host_tears; }
+unsigned long long host_copied_words(void) { return host_copied; }
+
+unsigned int host_hash_page(const unsigned char* page) {
+    unsigned int h = 2166136261u; // FNV-1a
+    for (int i = 0; i < SCREEN_WIDTH * SCREEN_HEIGHT; i++) { h ^= page[i]; h *= 16777619u; }
+    return h;
+}
+
+unsigned long long host_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (unsigned long long)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+unsigned int plat_clock(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (unsigned int)ts.tv_sec * GBA_CLOCK_FREQ + (unsigned int)(((unsigned long long)ts.tv_nsec << 24) / 1000000000ull);
+}
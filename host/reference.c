@@ -0,0 +1,33 @@
+#include <stdlib.h>
+#include "reference.h"
+
+// Frozen copies of routines the pipeline has since replaced, kept so the
+// host benchmark can report speedups and check pixel-exact equivalence.
+
+// --- Line Drawing (per-pixel Bresenham through a checked plot) ---
+static void ref_plot_pixel(int x, int y, unsigned char color) { if (x < 0 || x >= SCREEN_WIDTH || y < 0 || y >= SCREEN_HEIGHT) return; int i = (y * SCREEN_WIDTH + x) >> 1; unsigned short p = back_buffer[i]; if (x & 1) p = (p & 0x00FF) | (color << 8); else p = (p & 0xFF00) | color; back_buffer[i] = p; }
+void ref_draw_line(int x0, int y0, int x1, int y1, unsigned char color) { int dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1; int dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1; int err = dx + dy, e2; for (;;) { ref_plot_pixel(x0, y0, color); if (x0 == x1 && y0 == y1) break; e2 = 2 * err; if (e2 >= dy) { err += dy; x0 += sx; } if (e2 <= dx) { err += dx; y0 += sy; } } }
+
+// --- Vertex Transform (AoS, two sequential rotations, per-vertex camera test) ---
+void ref_transform_vertices(const Point3D* vertices, int num_vertices, short sin_x, short cos_x, short sin_y, short cos_y, enum CameraType camera, Point2D* out) {
+    for (int i = 0; i < num_vertices; i++) {
+        Point3D p = vertices[i];
+        Point3D temp, rotated;
+        temp.x = (p.x * cos_y - p.z * sin_y) >> FIXED_SHIFT; temp.z = (p.x * sin_y + p.z * cos_y) >> FIXED_SHIFT; temp.y = p.y;
+        rotated.y = (temp.y * cos_x - temp.z * sin_x) >> FIXED_SHIFT; rotated.z = (temp.y * sin_x + temp.z * cos_x) >> FIXED_SHIFT; rotated.x = temp.x;
+
+        if (camera == CAMERA_PERSPECTIVE) {
+            rotated.z += Z_OFFSET;
+            if (rotated.z > 0) {
+                int p_factor = (VIEWER_DISTANCE << FIXED_SHIFT) / rotated.z;
+                out[i].x = ((rotated.x * p_factor) >> FIXED_SHIFT) + (SCREEN_WIDTH / 2);
+                out[i].y = ((rotated.y * p_factor) >> FIXED_SHIFT) + (SCREEN_HEIGHT / 2);
+            } else {
+                out[i].x = REF_POINT_BEHIND;
+            }
+        } else { // Orthographic
+            out[i].x = rotated.x + (SCREEN_WIDTH / 2);
+            out[i].y = rotated.y + (SCREEN_HEIGHT / 2);
+        }
+    }
+}
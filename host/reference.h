@@ -0,0 +1,12 @@
+#ifndef REFERENCE_H
+#define REFERENCE_H
+
+#include "render.h"
+
+#define REF_POINT_BEHIND -10000
+typedef struct { int x, y, z; } Point3D;
+
+void ref_transform_vertices(const Point3D* vertices, int num_vertices, short sin_x, short cos_x, short sin_y, short cos_y, enum CameraType camera, Point2D* out);
+void ref_draw_line(int x0, int y0, int x1, int y1, unsigned char color);
+
+#endif // REFERENCE_H
@@ -0,0 +1,44 @@
+#ifndef ANIM_H
+#define ANIM_H
+
+#include "mesh.h"
+
+// Keyframed vertex animation read in place from ROM (include/animblob.h).
+// A frame is its keyframe's pose plus s8 deltas; transform_pose()
+// (include/transform.h) adds them as the transform kernel loads each
+// vertex, so no pose is ever expanded into RAM.
+
+typedef struct {
+    int num_vertices, num_frames;
+    const unsigned char* base;
+    const unsigned int* frame_offsets;
+} VertexAnim;
+
+// One frame: x/y/z of its keyframe, and d* = 0 when it is one.
+typedef struct {
+    const short *x, *y, *z;
+    const signed char *dx, *dy, *dz;
+    int shift;
+} AnimPose;
+
+// Points anim at blob. Returns 0 if blob is not an animation blob.
+int anim_load(VertexAnim* anim, const void* blob);
+void anim_pose(const VertexAnim* anim, int frame, AnimPose* pose);
+
+// --- Rippling Torus ---
+// Baked by tools/animgen from the Makefile's ANIM_ripple: ripple_blob is its
+// mesh (first pose, radius covering all of them), ripple_anim the loop.
+// The surface_ripple() arguments below must match it; `make check` decodes
+// every frame against them.
+#define RIPPLE_MAJOR_SEGMENTS 24
+#define RIPPLE_MINOR_SEGMENTS 12
+#define RIPPLE_MAJOR_RADIUS 50
+#define RIPPLE_MINOR_RADIUS 16
+#define RIPPLE_AMPLITUDE 5
+#define RIPPLE_WAVES 3
+#define RIPPLE_FRAMES 64
+extern const unsigned int ripple_blob[], ripple_anim[];
+extern Mesh ripple_mesh;
+extern VertexAnim ripple;
+
+#endif // ANIM_H
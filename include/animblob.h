@@ -0,0 +1,36 @@
+#ifndef ANIMBLOB_H
+#define ANIMBLOB_H
+
+// Packed vertex animation written by tools/animgen and read in place from
+// ROM. Little-endian; the blob, each frame record and every stream in one
+// are 4-byte aligned.
+//
+//   header (ANIM_BLOB_HEADER_SIZE bytes)
+//   u32 frame_offsets[num_frames], from the start of the blob
+//   one record per frame: an AnimFrameHeader, then
+//     keyframe (key == its own index): short x[], y[], z[] (each padded to 4)
+//     delta frame: signed char dx[], dy[], dz[] (each padded to 4), so that
+//       vertex = keyframe vertex + (delta << shift)
+//
+// Deltas are taken from the frame's keyframe rather than the frame before,
+// so any frame decodes from ROM alone, with no pose kept in RAM between
+// frames.
+
+#define ANIM_BLOB_MAGIC 0x314D4E41 // "ANM1"
+#define ANIM_BLOB_HEADER_SIZE 16
+
+typedef struct {
+    unsigned int magic;
+    unsigned int size;           // Whole blob in bytes
+    unsigned short num_vertices;
+    unsigned short num_frames;
+    unsigned int frame_offset;   // The frame_offsets table
+} AnimBlobHeader;
+
+typedef struct {
+    unsigned short key;          // Keyframe the deltas apply to
+    unsigned char shift;
+    unsigned char reserved;
+} AnimFrameHeader;
+
+#endif // ANIMBLOB_H
@@ -0,0 +1,40 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+// Bump allocators over two fixed regions: IWRAM (fast, 32 KB in all, shared
+// with the stack and the ARM kernels) for per-frame scratch, and EWRAM for
+// mesh storage. Each arena hands out persistent blocks from the bottom and
+// frame-scoped blocks from the top:
+//
+//   arena_alloc()        Lives until released to an earlier arena_mark();
+//                        mesh generation marks and releases its scratch.
+//   arena_frame_alloc()  Lives until the next arena_frame_reset(), called
+//                        at the start of every frame.
+//
+// Blocks are word aligned; both calls return 0 when the region is full.
+// high_water records the most each arena has had in use since arena_reset().
+
+enum ArenaRegion { ARENA_IWRAM, ARENA_EWRAM, NUM_ARENAS };
+
+#define ARENA_IWRAM_BYTES (8 * 1024)
+#define ARENA_EWRAM_BYTES (160 * 1024)
+
+typedef struct {
+    unsigned char* base;
+    unsigned int size;
+    unsigned int used;       // Persistent bytes, from the bottom
+    unsigned int frame_used; // Frame-scoped bytes, from the top
+    unsigned int high_water; // Largest used + frame_used so far
+} Arena;
+
+extern Arena arenas[NUM_ARENAS];
+
+void arena_reset(void); // Frees everything in both regions and clears high_water
+void* arena_alloc(enum ArenaRegion region, unsigned int bytes);
+void* arena_frame_alloc(enum ArenaRegion region, unsigned int bytes);
+void* arena_frame_alloc_any(unsigned int bytes); // IWRAM when it has room, else EWRAM
+static inline unsigned int arena_mark(enum ArenaRegion region) { return arenas[region].used; }
+void arena_release(enum ArenaRegion region, unsigned int mark);
+void arena_frame_reset(void);
+
+#endif // ARENA_H
@@ -0,0 +1,34 @@
+#ifndef CLEAR_H
+#define CLEAR_H
+
+#include "render.h"
+
+// Incremental screen clearing. Each page remembers what was drawn into it
+// the last time it was the back buffer (the previous frame: every frame is
+// drawn into the one offscreen page, include/present.h),
+// and clear_frame() removes exactly that instead of the whole 40 KB page.
+enum ClearMode {
+    CLEAR_FULL,  // DMA3 word fill of the whole page
+    CLEAR_DIRTY, // One span per scanline over the union of the page's dirty rects
+    CLEAR_ERASE, // Re-draw the page's previous lines in the background colour
+    NUM_CLEAR_MODES
+};
+
+#define CLEAR_DEFAULT CLEAR_DIRTY
+#define CLEAR_MAX_RECTS 8
+#define CLEAR_MAX_LINES 512
+
+extern enum ClearMode clear_mode;
+
+void clear_set_mode(enum ClearMode mode);
+void clear_frame(unsigned char color);
+
+// Drawing that bypasses the recorded lines (text, HUD) must mark its rect.
+void clear_mark_rect(int x0, int y0, int x1, int y1);
+void clear_mark_vertices(const VertexBuffer* vb, int num_vertices);
+void clear_record_line(int x0, int y0, int x1, int y1);
+
+// Called for every line drawn into back_buffer; only ERASE mode keeps them.
+static inline void clear_track_line(int x0, int y0, int x1, int y1) { if (clear_mode == CLEAR_ERASE) clear_record_line(x0, y0, x1, y1); }
+
+#endif // CLEAR_H
@@ -0,0 +1,15 @@
+#ifndef DEMO_H
+#define DEMO_H
+
+#include "render.h"
+
+void demo_init(void);
+void demo_frame(void);
+
+// Rebuilds the torus LODs with major x minor segments at the finest level.
+// Returns 0, keeping the current torus, if they do not fit the arena.
+int demo_set_torus(int major, int minor);
+// The last frame's transformed vertices and edge stats (faces when filled).
+void demo_work(int* vertices, EdgeStats* stats);
+
+#endif // DEMO_H
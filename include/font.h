@@ -95,7 +95,7 @@ const unsigned char font_data[128][8] = {
     {0x66,0x66,0x66,0x3C,0x18,0x18,0x18,0x00}, // 89 Y
     {0x7E,0x06,0x0C,0x18,0x30,0x60,0x7E,0x00}, // 90 Z
     {0x3C,0x30,0x30,0x30,0x30,0x30,0x3C,0x00}, // 91 [
-    {0x40,0x60,0x30,0x18,0x0C,0x06,0x03,0x00}, // 92 \\
+    {0x40,0x60,0x30,0x18,0x0C,0x06,0x03,0x00}, // 92 backslash
     {0x3C,0x0C,0x0C,0x0C,0x0C,0x0C,0x3C,0x00}, // 93 ]
     {0x10,0x38,0x6C,0xC6,0x00,0x00,0x00,0x00}, // 94 ^
     {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF}, // 95 _
@@ -0,0 +1,77 @@
+#ifndef FRAMEBUFFER_H
+#define FRAMEBUFFER_H
+
+#include "platform.h"
+
+// Framebuffer backends: how pixels reach the screen. Mode 4 VRAM takes no
+// byte stores, so drawing straight into it costs a halfword
+// read-modify-write for every lone pixel, but nothing to present. The
+// offscreen backends draw into the EWRAM page with plain byte stores and
+// pay for one bulk copy into the hidden VRAM page per frame instead:
+//
+//   FB_VRAM  Draw into the hidden VRAM page; present queues it for a flip
+//            and waits for it (double buffering).
+//   FB_DMA   Offscreen, DMA3 copy of the whole page.
+//   FB_LDM   Offscreen, ARM ldm/stm copy of the whole page from IWRAM.
+//   FB_ROWS  Offscreen, DMA3 copy of only the rows drawn since that VRAM
+//            page was last filled.
+//
+// All of them produce the same pixels. host/bench.c compares their cost on
+// meshes of increasing edge count.
+
+enum FbBackendId { FB_VRAM, FB_DMA, FB_LDM, FB_ROWS, NUM_FB_BACKENDS };
+#define FB_DEFAULT FB_DMA
+
+#define LINE_OPEN    1 // Leave out the end pixel (polyline segments)
+#define LINE_GUARDED 2 // Endpoints may lie in the guard band around the screen
+
+typedef struct {
+    const char* name;
+    int offscreen;                      // Draws into the offscreen page, else straight into VRAM
+    void (*clear)(unsigned char color); // Whole page
+    // Unchecked: coordinates must be on screen (line: unless LINE_GUARDED).
+    void (*hspan)(int y, int xa, int xb, unsigned char color);
+    void (*pixel)(int x, int y, unsigned char color);
+    void (*line)(int x0, int y0, int x1, int y1, unsigned char color, int flags);
+    // Convex polygon of n vertices wound like a front face (include/render.h),
+    // clipped to the screen; coordinates within +-16383.
+    void (*fill)(const int* xs, const int* ys, int n, unsigned char color);
+    void (*present)(int vram_page);     // Offscreen only: fill vram_page with the frame
+} FbBackend;
+
+extern const FbBackend fb_backends[NUM_FB_BACKENDS];
+extern const FbBackend* fb;
+
+// Waits for any queued frame to be shown, then points back_buffer at the
+// new backend's target. The next clear is a full one.
+void fb_set_backend(enum FbBackendId id);
+
+// Rows written into the offscreen page since the last present, for FB_ROWS.
+// Kernels that write back_buffer directly (the HUD) must report theirs.
+extern int fb_row_min, fb_row_max;
+static inline void fb_touch_rows(int y0, int y1) {
+    if (y0 < fb_row_min) fb_row_min = y0;
+    if (y1 > fb_row_max) fb_row_max = y1;
+}
+
+// --- Kernels (source/raster.c) ---
+void raster_hspan_vram(int y, int xa, int xb, unsigned char color);
+void raster_pixel_vram(int x, int y, unsigned char color);
+void raster_line_vram(int x0, int y0, int x1, int y1, unsigned char color, int flags);
+void raster_fill_vram(const int* xs, const int* ys, int n, unsigned char color);
+void raster_hspan_bytes(int y, int xa, int xb, unsigned char color);
+void raster_pixel_bytes(int x, int y, unsigned char color);
+void raster_line_bytes(int x0, int y0, int x1, int y1, unsigned char color, int flags);
+void raster_fill_bytes(const int* xs, const int* ys, int n, unsigned char color);
+// raster_line_* for the flags known at the call site, as the specialized
+// edge stages (include/render.h) use them: open is LINE_OPEN's 0 or 1.
+void raster_segment_vram(int x0, int y0, int x1, int y1, unsigned char color, int open);
+void raster_segment_guarded_vram(int x0, int y0, int x1, int y1, unsigned char color, int open);
+void raster_segment_bytes(int x0, int y0, int x1, int y1, unsigned char color, int open);
+void raster_segment_guarded_bytes(int x0, int y0, int x1, int y1, unsigned char color, int open);
+
+// Word copy with 8-register ldm/stm, ARM code in IWRAM (source/blit.iwram.c).
+// words must be a multiple of 4.
+void blit_words(volatile void* dst, const volatile void* src, int words);
+
+#endif // FRAMEBUFFER_H
@@ -0,0 +1,45 @@
+#ifndef GBA_H
+#define GBA_H
+
+// --- GBA Hardware Registers ---
+#define REG_DISPCNT *(volatile unsigned short *)0x04000000
+#define PALETTE_MEM ((volatile unsigned short *)0x05000000)
+#define REG_DISPSTAT *(volatile unsigned short *)0x04000004
+#define REG_VCOUNT *(volatile unsigned short *)0x04000006
+#define REG_KEYINPUT *(volatile unsigned short *)0x04000130
+
+// Timer Registers
+#define REG_TM0CNT_L *(volatile unsigned short*)0x4000100
+#define REG_TM0CNT_H *(volatile unsigned short*)0x4000102
+#define REG_TM1CNT_L *(volatile unsigned short*)0x4000104
+#define REG_TM1CNT_H *(volatile unsigned short*)0x4000106
+#define TIMER_ENABLE 0x0080
+#define TIMER_CASCADE 0x0004
+
+// DMA Channel 3
+#define REG_DMA3SAD *(volatile unsigned int*)0x40000D4
+#define REG_DMA3DAD *(volatile unsigned int*)0x40000D8
+#define REG_DMA3CNT *(volatile unsigned int*)0x40000DC
+#define DMA_SRC_FIXED 0x01000000
+#define DMA_32 0x04000000
+#define DMA_ENABLE 0x80000000
+
+// Interrupts
+#define REG_IE *(volatile unsigned short*)0x4000200
+#define REG_IF *(volatile unsigned short*)0x4000202
+#define REG_IME *(volatile unsigned short*)0x4000208
+#define REG_IFBIOS *(volatile unsigned short*)0x3007FF8 // Acknowledged for the IntrWait BIOS call
+#define REG_IRQ_HANDLER *(void (**)(void))0x3007FFC
+#define IRQ_VBLANK 0x0001
+#define DISPSTAT_VBLANK_IRQ 0x0008
+
+// Video modes and display options
+#define MODE4 0x0004
+#define BG2_ENABLE 0x0400
+#define DISP_BACKBUFFER 0x0010
+
+// VRAM pages; the one not on screen receives each finished frame
+#define VRAM_PAGE0 ((volatile unsigned short *)0x06000000)
+#define VRAM_PAGE1 ((volatile unsigned short *)0x0600A000)
+
+#endif // GBA_H
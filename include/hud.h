@@ -0,0 +1,25 @@
+#ifndef HUD_H
+#define HUD_H
+
+// Cached text overlay. Each HUD line is rasterized once into an 8bpp
+// bitmap when its value changes and then copied into the back buffer with
+// word stores every frame. No stdio: numbers go through hud_put_uint.
+
+#define HUD_MAX_LINES 9
+#define HUD_MAX_CHARS 28
+#define HUD_X 4 // Word aligned so rows can be copied as whole words
+#define HUD_Y 5
+#define HUD_LINE_SPACING 10
+
+void hud_init(unsigned char color);
+void hud_line_text(int line, const char* text);
+void hud_line_uint(int line, const char* label, unsigned int value);
+void hud_line_ms(int line, const char* label, unsigned int ticks);
+void hud_draw(void);
+
+// Formatting helpers; each returns the end of what it wrote (no terminator).
+char* hud_put_str(char* p, const char* s);
+char* hud_put_uint(char* p, unsigned int value);
+char* hud_put_ms(char* p, unsigned int ticks);
+
+#endif // HUD_H
@@ -0,0 +1,103 @@
+#ifndef MESH_H
+#define MESH_H
+
+#include "render.h"
+#include "surface.h"
+
+// Wireframe meshes. Vertices are stored as separate x/y/z short streams
+// (SoA) so the transform kernel can walk them with post-incremented loads.
+// Edges are stored as strips (include/strip.h) and drawn edge by edge, or
+// as polylines with render_set_polylines().
+// Meshes loaded from a packed blob (include/meshblob.h) point straight into
+// ROM; exactly one of strips / strips8 is set, matching the blob's index width.
+// Closed meshes also carry quad faces, wound counter-clockwise seen from
+// outside, and the faces next to each strip edge for hidden-line removal.
+typedef struct {
+    int num_vertices;
+    int num_edges;
+    const short* x;
+    const short* y;
+    const short* z;
+    int num_strips;
+    const unsigned short* strips;
+    const unsigned char* strips8;
+    int radius;        // Bounding sphere, model units; culling and LOD pick
+    short center[3];
+    int num_faces;                         // 0 without face data
+    const unsigned short (*faces)[4];
+    const unsigned short (*edge_faces)[2]; // In strip edge order (strip_edge_faces)
+    int shift;                             // x/y/z hold model units << shift (objconv)
+} Mesh;
+
+// Largest mesh whose per-frame buffers (vertex_buffer_alloc) the IWRAM
+// arena is sized for; larger meshes spill into EWRAM.
+#define MAX_MESH_VERTICES 512
+#define MAX_MESH_FACES 512
+
+// Points mesh at the streams inside blob. Returns 0 if blob is not a mesh blob.
+int mesh_load(Mesh* mesh, const void* blob);
+
+// Draws a mesh's strips, transformed by the same pipeline variant. With
+// hidden_lines on and face data present, edges whose faces all point away
+// from the camera are skipped; with solid_fill on and vb->depth allocated,
+// the faces are filled instead.
+void draw_mesh(const Mesh* mesh, const Pipeline* pipe, const VertexBuffer* vb, unsigned char color, EdgeStats* stats);
+
+// --- Cube Model Data ---
+// Converted from assets/cube.obj at build time; loaded by mesh_init().
+extern const unsigned int cube_blob[];
+extern Mesh cube_mesh;
+
+// --- Baked Meshes ---
+// With BAKED_MESHES (the default) the default torus LODs and the surfaces
+// are generated at build time by tools/meshgen, with the same code as
+// mesh_generate(), and read in place from ROM: nothing is computed or
+// allocated at boot. BAKED_MESHES=0 generates them into the EWRAM arena in
+// mesh_init() instead. The Makefile's SURFACE_* arguments must match the
+// runtime parameters below; `make check` compares the two.
+#ifndef BAKED_MESHES
+#define BAKED_MESHES 1
+#endif
+extern const unsigned int torus_lod0_blob[], torus_lod1_blob[], torus_lod2_blob[];
+extern const unsigned int sphere_blob[], cylinder_blob[], grid_blob[], mobius_blob[];
+
+// --- Torus Model Data ---
+// Distance LODs, finest first: each level halves both segment counts (down
+// to 3). The default is 32x16, so 16x8 and 8x4 below it; the single-model
+// view shows TORUS_LOD_DEFAULT.
+#define NUM_TORUS_LODS 3
+#define TORUS_LOD_DEFAULT 1
+#define TORUS_MAJOR_SEGMENTS 32
+#define TORUS_MINOR_SEGMENTS 16
+#define TORUS_MAJOR_RADIUS 50
+#define TORUS_MINOR_RADIUS 20
+#define NUM_MAJOR_SEGMENTS (TORUS_MAJOR_SEGMENTS >> TORUS_LOD_DEFAULT)
+#define NUM_MINOR_SEGMENTS (TORUS_MINOR_SEGMENTS >> TORUS_LOD_DEFAULT)
+#define NUM_TORUS_VERTICES (NUM_MAJOR_SEGMENTS * NUM_MINOR_SEGMENTS)
+#define NUM_TORUS_EDGES (NUM_MAJOR_SEGMENTS * NUM_MINOR_SEGMENTS * 2)
+extern Mesh torus_lods[NUM_TORUS_LODS];
+
+// --- Surface Model Data ---
+// One mesh per surface type for the single-model view; the torus slot is
+// unused (see torus_lods).
+typedef struct { unsigned char u, v, a, b; } SurfaceParams;
+extern const SurfaceParams surface_params[NUM_SURFACES];
+extern Mesh surface_meshes[NUM_SURFACES];
+
+// --- Model Generation ---
+// Loads the cube, the rippling torus (include/anim.h) and the surfaces,
+// baked or generated (BAKED_MESHES), and leaves the torus LODs empty.
+void mesh_init(void);
+// Builds a surface (include/surface.h) in the EWRAM arena, with u16 strips.
+// Returns 0, allocating nothing, if it does not fit.
+int mesh_generate(Mesh* mesh, enum SurfaceType type, int u, int v, int a, int b);
+// Builds every torus LOD in the EWRAM arena (include/arena.h); release to a
+// mark taken before the call to free it. Returns 0, leaving the LODs empty,
+// if the arena is too small for these segment counts.
+int generate_torus(int major_segments, int minor_segments, int major_radius, int minor_radius);
+// Points the torus LODs at the baked default torus in ROM. Returns 0 unless
+// the segment counts are TORUS_MAJOR_SEGMENTS x TORUS_MINOR_SEGMENTS and
+// the build has BAKED_MESHES.
+int load_torus(int major_segments, int minor_segments);
+
+#endif // MESH_H
@@ -0,0 +1,34 @@
+#ifndef MESHBLOB_H
+#define MESHBLOB_H
+
+// Packed mesh format written by tools/objconv and read in place from ROM.
+// All fields are little-endian; the blob and every stream in it are 4-byte
+// aligned, so the streams can be used directly as the Mesh SoA arrays.
+//
+//   header (MESH_BLOB_HEADER_SIZE bytes)
+//   short x[num_vertices], y[num_vertices], z[num_vertices] (each padded to 4)
+//   edge strips (include/strip.h) of u8 (index_size 1) or u16 (index_size 2)
+//   u16 faces[num_faces][4], u16 edge_faces[num_edges][2] (strip_edge_faces),
+//   both absent when num_faces is 0
+
+#define MESH_BLOB_MAGIC 0x3348534D // "MSH3"
+#define MESH_BLOB_HEADER_SIZE 56
+
+typedef struct {
+    unsigned int magic;
+    unsigned int size;           // Whole blob in bytes
+    unsigned short num_vertices;
+    unsigned short num_edges;
+    unsigned char index_size;    // 1 when num_vertices <= 256, else 2
+    unsigned char shift;         // Coordinates are stored as model units << shift
+    unsigned short radius;       // Bounding sphere, model units
+    short center[3];
+    unsigned short num_strips;
+    unsigned int scale;          // Model units per OBJ unit, 16.16; a record of the conversion
+    unsigned int x_offset, y_offset, z_offset, strip_offset; // From the start of the blob
+    unsigned short num_faces;
+    unsigned short reserved2;
+    unsigned int face_offset, edge_face_offset;
+} MeshBlobHeader;
+
+#endif // MESHBLOB_H
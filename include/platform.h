@@ -0,0 +1,75 @@
+#ifndef PLATFORM_H
+#define PLATFORM_H
+
+// Thin platform layer between the render pipeline and the hardware.
+// source/platform_gba.c drives the real registers; host/platform_host.c
+// renders into in-memory Mode 4 pages so the pipeline can run headless.
+
+// --- Display Constants ---
+#define SCREEN_WIDTH 240
+#define SCREEN_HEIGHT 160
+#define SCREEN_X_MIN 0
+#define SCREEN_X_MAX (SCREEN_WIDTH - 1)
+#define SCREEN_Y_MIN 0
+#define SCREEN_Y_MAX (SCREEN_HEIGHT - 1)
+#define VRAM_PAGE_SIZE 0xA000
+#define PAGE_BYTES (SCREEN_WIDTH * SCREEN_HEIGHT)
+#define NUM_VRAM_PAGES 2
+#define NUM_PAGES 2 // Pages back_buffer cycles through: both VRAM pages, or the offscreen one
+
+// --- Input Constants ---
+#define KEY_A 0x0001
+#define KEY_B 0x0002
+#define KEY_SELECT 0x0004
+#define KEY_START 0x0008
+#define KEY_RIGHT 0x0010
+#define KEY_LEFT 0x0020
+#define KEY_UP 0x0040
+#define KEY_DOWN 0x0080
+#define KEY_R 0x0100
+#define KEY_L 0x0200
+
+// --- Timing ---
+#define GBA_CLOCK_FREQ 16777216
+#define SCANLINE_TICKS 1232
+#define VBLANK_LINE 160 // First scanline of VBlank; 228 scanlines per frame
+#define TICKS_PER_FRAME 280896 // 228 scanlines * 1232 cycles
+
+// Mode 4 page being drawn: the offscreen page (EWRAM on the GBA), or with
+// the FB_VRAM backend the hidden VRAM page (include/framebuffer.h).
+extern volatile unsigned short* back_buffer;
+
+void plat_init(void);
+void plat_set_palette(int index, unsigned short color);
+int plat_page(void); // Index of back_buffer, 0 .. NUM_PAGES - 1; the VRAM page if in VRAM
+void plat_set_target(int vram_page); // Point back_buffer at a VRAM page, or -1 for offscreen
+void plat_fill32(volatile void* dst, unsigned int value, int words);
+unsigned short plat_keys(void); // Held keys, 1 = pressed
+void* plat_stack_limit(void); // Lowest address the stack may reach (include/stack.h)
+
+// Display hooks for the flip scheduler. plat_wait_vblank() sleeps until the
+// VBlank interrupt has run, returning at once if it ran since the last call.
+// plat_irq_lock() holds the interrupt off until plat_irq_unlock().
+void plat_copy_rows(int vram_page, int y0, int y1); // Offscreen rows y0..y1 into a VRAM page, DMA3
+volatile unsigned short* plat_vram_page(int vram_page);
+void plat_show_page(int vram_page);
+void plat_wait_vblank(void);
+void plat_irq_lock(void);
+void plat_irq_unlock(void);
+unsigned int plat_vcount(void); // Scanline being displayed, 0 .. 227
+
+// plat_ticks() drives everything the demo displays; plat_clock() is what the
+// profiler reads. They are the same timer on the GBA. On the host plat_ticks()
+// is simulated so the output is deterministic, and plat_clock() is wall time
+// in the same units (1 / GBA_CLOCK_FREQ seconds).
+#ifdef PLATFORM_HOST
+unsigned int plat_ticks(void);
+unsigned int plat_clock(void);
+#else
+#include "gba.h"
+static inline unsigned int plat_ticks(void) { return (REG_TM1CNT_L << 16) | REG_TM0CNT_L; }
+static inline unsigned int plat_clock(void) { return plat_ticks(); }
+void plat_irq_handler(void); // ARM, IWRAM (source/platform_gba.iwram.c)
+#endif
+
+#endif // PLATFORM_H
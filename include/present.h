@@ -0,0 +1,45 @@
+#ifndef PRESENT_H
+#define PRESENT_H
+
+#include "platform.h"
+
+// VBlank-driven flip scheduler with triple buffering. Frames are drawn into
+// the offscreen back_buffer. present_frame() DMA-copies a finished frame
+// into the VRAM page that is not on screen and queues that page; the VBlank
+// interrupt flips to it when the pacing allows. Drawing of the next frame
+// starts as soon as the copy is done instead of waiting for the flip: the
+// offscreen page, the queued page and the page on screen are the three
+// buffers.
+//
+// PACE_60 and PACE_30 show every frame, flipping at most once every one or
+// two VBlanks; present_frame() only waits while the previous frame is still
+// queued. PACE_UNCAPPED never waits: a frame still queued at the next
+// present is overwritten (dropped), so each VBlank shows the newest finished
+// frame, except that a VBlank landing during the copy keeps the old page.
+//
+// The framebuffer backend (include/framebuffer.h) does the copy. FB_VRAM
+// draws into the hidden VRAM page itself, which leaves only two buffers:
+// present_frame() queues that page and waits for its flip in every mode.
+
+enum FramePacing { PACE_60, PACE_30, PACE_UNCAPPED, NUM_PACINGS };
+
+typedef struct {
+    unsigned int vblanks;   // Interrupts taken
+    unsigned int presented; // Frames passed to present_frame()
+    unsigned int shown;     // Flips
+    unsigned int dropped;   // Overwritten while queued (uncapped only)
+    unsigned int waits;     // VBlanks present_frame() slept through
+} PresentStats;
+
+extern enum FramePacing frame_pacing;
+extern PresentStats present_stats;
+
+// Shows VRAM page 0 with nothing queued; call after plat_init().
+void present_init(void);
+void present_set_pacing(enum FramePacing pacing);
+void present_frame(void);
+void present_vblank(void); // Body of the VBlank interrupt
+// Lets a queued page be shown, then points back_buffer at fb's target.
+void present_retarget(void);
+
+#endif // PRESENT_H
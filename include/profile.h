@@ -0,0 +1,52 @@
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include "platform.h"
+
+// Frame profiler. PROF_BEGIN/PROF_END bracket a zone and add its timer
+// ticks to the zone's total for the current frame, so a zone may be entered
+// any number of times (the clip zone runs once per clipped edge).
+// prof_end_frame() pushes the totals into a ring holding the last
+// PROF_HISTORY frames. Zones nest statically as given by prof_zone_parent;
+// a parent's time includes its children's.
+//
+// A zone costs two timer reads and an add, cheap enough to leave on in
+// release builds. Build with PROFILE_ENABLED=0 (make PROFILE=0) to compile
+// every zone and the ring out.
+
+#ifndef PROFILE_ENABLED
+#define PROFILE_ENABLED 1
+#endif
+
+#define PROF_HISTORY 256
+
+enum ProfZone { PROF_FRAME, PROF_CLEAR, PROF_TRANSFORM, PROF_RASTER, PROF_CLIP, PROF_HUD, PROF_PRESENT, NUM_PROF_ZONES };
+
+typedef struct { unsigned int min, avg, max, p99; } ProfStats; // Ticks per frame
+
+extern const char* const prof_zone_names[NUM_PROF_ZONES];
+extern const signed char prof_zone_parent[NUM_PROF_ZONES]; // -1 for the root
+
+#if PROFILE_ENABLED
+extern unsigned int prof_start[NUM_PROF_ZONES];
+extern unsigned int prof_accum[NUM_PROF_ZONES];
+#define PROF_BEGIN(zone) (prof_start[zone] = plat_clock())
+#define PROF_END(zone) (prof_accum[zone] += plat_clock() - prof_start[zone])
+
+void prof_reset(void);
+void prof_end_frame(void);
+int prof_frames(void); // Frames held in the ring, up to PROF_HISTORY
+unsigned int prof_sample(int frames_ago, int zone);
+void prof_stats(int zone, ProfStats* out);
+#else
+#define PROF_BEGIN(zone) ((void)0)
+#define PROF_END(zone) ((void)0)
+
+static inline void prof_reset(void) {}
+static inline void prof_end_frame(void) {}
+static inline int prof_frames(void) { return 0; }
+static inline unsigned int prof_sample(int frames_ago, int zone) { (void)frames_ago; (void)zone; return 0; }
+static inline void prof_stats(int zone, ProfStats* out) { (void)zone; out->min = out->avg = out->max = out->p99 = 0; }
+#endif
+
+#endif // PROFILE_H
@@ -0,0 +1,78 @@
+#ifndef RECIP_H
+#define RECIP_H
+
+// Fixed-point reciprocals from a ROM table, replacing the library divide
+// the ARM7TDMI would otherwise call for every perspective vertex and every
+// clip plane test.
+//
+// recip(d) ~= 2^RECIP_SHIFT / d, a direct lookup of the correctly rounded
+// value for 0 < d <= RECIP_TABLE_SIZE (every reachable view depth), with
+// relative error below 2^-15.
+//
+// Larger divisors go through recip_norm(), which shifts d into [512, 1024),
+// interpolates linearly between the two neighbouring entries and hands the
+// shift back to the caller, so recip_div() keeps table precision for any d:
+// relative error below 2^-13, plus one unit of truncation in the result.
+//
+// host/check_recip.c checks both bounds exhaustively.
+
+#define RECIP_SHIFT 24
+#define RECIP_TABLE_SIZE 1024
+
+extern const unsigned int recip_table[RECIP_TABLE_SIZE + 1];
+
+// 2^(RECIP_SHIFT + *shift) / d for any d > 0.
+static inline unsigned int recip_norm(unsigned int d, int* shift) {
+    if (d <= RECIP_TABLE_SIZE) { *shift = 0; return recip_table[d]; }
+    int s = 1;
+    while ((d >> s) >= RECIP_TABLE_SIZE) s++;
+    unsigned int i = d >> s, frac = d & ((1u << s) - 1);
+    *shift = s;
+    return recip_table[i] - (((recip_table[i] - recip_table[i + 1]) * frac) >> s);
+}
+
+// Past the table the low bits of the result are lost; use recip_div there.
+static inline unsigned int recip(unsigned int d) {
+    int s;
+    unsigned int r = recip_norm(d, &s);
+    return r >> s;
+}
+
+// (n * r) >> k, floored, for r < 2^31 and 0 < k < 64, from four 16x16
+// partial products: Thumb code has no long multiply, and the 64-bit C
+// expression becomes libgcc __aeabi_lmul and __aeabi_lasr calls.
+static inline int recip_mul_shr16(int n, unsigned int r, int k) {
+    unsigned int a = n < 0 ? -(unsigned int)n : (unsigned int)n;
+    unsigned int al = a & 0xFFFF, ah = a >> 16, rl = r & 0xFFFF, rh = r >> 16;
+    unsigned int low = al * rl, mid = ah * rl + al * rh; // < 2^32: ah, rh < 2^16 and r < 2^31
+    unsigned int t = (low >> 16) + (mid & 0xFFFF);
+    unsigned int lo = (t << 16) | (low & 0xFFFF);
+    int hi = ah * rh + (mid >> 16) + (t >> 16);
+    if (n < 0) { lo = -lo; hi = ~hi + !lo; }
+    return k >= 32 ? hi >> (k - 32) : (int)((lo >> k) | ((unsigned int)hi << (32 - k)));
+}
+
+// The same with one smull in ARM code (the IWRAM kernels), and in plain C
+// on the host.
+static inline int recip_mul_shr(int n, unsigned int r, int k) {
+#if defined(__arm__) && !defined(__thumb__)
+    unsigned int lo;
+    int hi;
+    __asm__("smull %0, %1, %2, %3" : "=&r"(lo), "=&r"(hi) : "r"(n), "r"(r));
+    return k >= 32 ? hi >> (k - 32) : (int)((lo >> k) | ((unsigned int)hi << (32 - k)));
+#elif defined(__thumb__)
+    return recip_mul_shr16(n, r, k);
+#else
+    return (int)(((long long)n * r) >> k);
+#endif
+}
+
+// (n << shift) / d for d != 0, rounded toward minus infinity on n's side.
+static inline int recip_div(int n, int d, int shift) {
+    int s;
+    unsigned int r = recip_norm(d < 0 ? -d : d, &s);
+    int q = recip_mul_shr(n, r, RECIP_SHIFT + s - shift);
+    return d < 0 ? -q : q;
+}
+
+#endif // RECIP_H
@@ -0,0 +1,181 @@
+#ifndef RENDER_H
+#define RENDER_H
+
+#include "platform.h"
+#include "framebuffer.h"
+
+// --- Math and Camera ---
+#define FIXED_SHIFT 12 // Use 12-bit fractional part for high-res LUT
+#define VIEWER_DISTANCE 256
+#define Z_OFFSET 120
+#define NEAR_Z 8 // View depth of the perspective near plane
+#define GUARD_BAND_DEFAULT 32
+
+// --- Data Structures ---
+typedef struct { short x, y; } Point2D; // Screen coordinates from the transform stage
+typedef struct { short x, y, z; } ViewPoint; // Camera space, after the model's translation
+
+// Per-vertex output of the transform stage. Outcodes are computed once per
+// vertex here rather than once per edge endpoint.
+typedef struct {
+    Point2D* screen;      // Undefined for CLIP_NEAR vertices
+    unsigned char* codes;
+    ViewPoint* view;      // Read by the near-plane clip and the solid fill
+    unsigned char* front; // Per face, for hidden-line removal; may be NULL
+    int* depth;           // Per face, for the solid fill's sort; may be NULL
+    unsigned short* order;
+} VertexBuffer;
+
+// Frame-scoped storage for a mesh of num_vertices vertices and num_faces
+// faces: IWRAM when the arena has room, else EWRAM (include/arena.h).
+// Returns 0 if neither has.
+#define VERTEX_BUFFER_BYTES(nv, nf) ((sizeof(Point2D) + sizeof(ViewPoint) + 1) * (nv) + (nf))
+int vertex_buffer_alloc(VertexBuffer* vb, int num_vertices, int num_faces);
+// The solid fill's per-face sort keys and draw order, from the same arenas.
+#define FACE_ORDER_BYTES(nf) ((sizeof(int) + sizeof(unsigned short)) * (nf))
+int face_order_alloc(VertexBuffer* vb, int num_faces);
+
+typedef struct { int accepted, guarded, clipped, rejected, hidden; } EdgeStats;
+enum ModelType { MODEL_CUBE, MODEL_TORUS, MODEL_SCENE, MODEL_RIPPLE, NUM_MODELS };
+enum CameraType { CAMERA_PERSPECTIVE, CAMERA_ORTHOGRAPHIC };
+
+// --- Graphics Functions ---
+void clear_screen(unsigned char color);
+
+// --- Rasterizer (source/raster.c, through the framebuffer backend) ---
+// Unchecked: coordinates must already be on screen.
+static inline void draw_hspan(int y, int xa, int xb, unsigned char color) { fb->hspan(y, xa, xb, color); }
+static inline void draw_line(int x0, int y0, int x1, int y1, unsigned char color) { fb->line(x0, y0, x1, y1, color, 0); }
+// Endpoints may lie anywhere inside the guard band; off-screen pixels are skipped.
+static inline void draw_line_guarded(int x0, int y0, int x1, int y1, unsigned char color) { fb->line(x0, y0, x1, y1, color, LINE_GUARDED); }
+// Polyline segments: as above but without the end pixel, which the next
+// segment draws as its start.
+static inline void draw_line_open(int x0, int y0, int x1, int y1, unsigned char color) { fb->line(x0, y0, x1, y1, color, LINE_OPEN); }
+static inline void draw_line_guarded_open(int x0, int y0, int x1, int y1, unsigned char color) { fb->line(x0, y0, x1, y1, color, LINE_GUARDED | LINE_OPEN); }
+
+// --- Clipping ---
+#define CLIP_INSIDE 0
+#define CLIP_LEFT   1
+#define CLIP_RIGHT  2
+#define CLIP_BOTTOM 4
+#define CLIP_TOP    8
+#define CLIP_SCREEN 15 // Any of the four screen sides
+#define CLIP_GUARD  16 // Outside the guard band: needs a real clip
+#define CLIP_NEAR   32 // In front of the near plane (perspective only)
+
+// Lines whose endpoints are all within guard_band pixels of the screen are
+// drawn by the scissoring rasterizer instead of being clipped.
+extern int guard_band;
+void render_set_guard_band(int margin);
+
+static inline int outcode_guard(int x, int y, int guard) {
+    return (x < SCREEN_X_MIN) | ((x > SCREEN_X_MAX) << 1) | ((y < SCREEN_Y_MIN) << 2) | ((y > SCREEN_Y_MAX) << 3) |
+           (((unsigned int)(x + guard) > (unsigned int)(SCREEN_X_MAX + 2 * guard) || (unsigned int)(y + guard) > (unsigned int)(SCREEN_Y_MAX + 2 * guard)) << 4);
+}
+static inline int compute_outcode(int x, int y) { return outcode_guard(x, y, guard_band); }
+// Perspective divisor for a view point on or past the near plane: its depth,
+// raised where the point would land more than about 16384 px
+// (VIEWER_DISTANCE << PROJECT_RANGE_SHIFT) from the centre. That pulls it
+// back along its ray from the centre, so Point2D cannot wrap and the edges
+// to it keep their direction on screen.
+#define PROJECT_RANGE_SHIFT 6
+static inline int project_depth(int x, int y, int z) {
+    int ax = x < 0 ? -x : x, ay = y < 0 ? -y : y;
+    int d = (ax > ay ? ax : ay) >> PROJECT_RANGE_SHIFT;
+    return d > z ? d : z;
+}
+// Projects the point where the view-space edge from in to behind crosses
+// the near plane.
+void near_clip(const ViewPoint* in, const ViewPoint* behind, int* sx, int* sy);
+int clip_test(long p, long q, long* t0, long* t1);
+int liang_barsky_clip(int* x0, int* y0, int* x1, int* y1);
+
+// --- Pipeline Stages ---
+// These take any vertex buffer: they run the perspective, guard band
+// variant below for fb's pixel format.
+void draw_edges(const VertexBuffer* vb, const unsigned short (*edges)[2], int num_edges, unsigned char color, EdgeStats* stats);
+// Edge strips in the layout of include/strip.h, u16 or u8 indices, drawn as
+// open polylines (PIPE_STRIPS).
+void draw_strips(const VertexBuffer* vb, const unsigned short* strips, int num_strips, unsigned char color, EdgeStats* stats);
+void draw_strips8(const VertexBuffer* vb, const unsigned char* strips, int num_strips, unsigned char color, EdgeStats* stats);
+
+// --- Specialized Pipelines ---
+// The per-vertex and per-edge tests of the transform and edge stages hinge
+// on four things fixed for a whole frame: only the perspective camera puts
+// vertices behind the near plane, only a guard band lets edges crossing the
+// screen edge skip the clipper, the backend's pixel format picks the line
+// kernel, and only polylines hand each strip vertex's pixel to the next
+// segment. Each combination is compiled as its own variant, a transform
+// kernel (source/transform.iwram.c) and an edge stage (source/render.c)
+// with those tests folded away and the line kernel called directly rather
+// than through fb->line. pipeline_select() picks one from the table once per
+// frame for transform_mesh() and draw_mesh().
+#define PIPE_NEAR  1 // Perspective, with near-plane clipping; else orthographic
+#define PIPE_GUARD 2 // Guard band scissoring; else every edge off screen is clipped
+#define PIPE_BYTES 4 // Offscreen byte page; else Mode 4 VRAM
+#define PIPE_STRIPS 8 // Strips as open polylines, shared vertices plotted once; else each segment is a whole edge
+#define NUM_PIPELINES 16
+
+typedef struct {
+    const char* name;
+    int flags; // PIPE_*, also the variant's index in pipelines
+    void (*draw_edges)(const VertexBuffer* vb, const unsigned short (*edges)[2], int num_edges, unsigned char color, EdgeStats* stats);
+    void (*draw_strips)(const VertexBuffer* vb, const unsigned short* strips, int num_strips, unsigned char color, EdgeStats* stats);
+    void (*draw_strips8)(const VertexBuffer* vb, const unsigned char* strips, int num_strips, unsigned char color, EdgeStats* stats);
+    void (*draw_strips_hidden)(const VertexBuffer* vb, const unsigned short* strips, int num_strips,
+                               const unsigned short (*edge_faces)[2], unsigned char color, EdgeStats* stats);
+    void (*draw_strips8_hidden)(const VertexBuffer* vb, const unsigned char* strips, int num_strips,
+                                const unsigned short (*edge_faces)[2], unsigned char color, EdgeStats* stats);
+} Pipeline;
+
+extern const Pipeline pipelines[NUM_PIPELINES];
+// The variant for camera with the current guard_band, polylines and fb. A
+// vertex buffer must be drawn by the variant that transformed it.
+const Pipeline* pipeline_select(enum CameraType camera);
+
+// --- Polylines ---
+// With polylines on, meshes are drawn by the PIPE_STRIPS variants. Off by
+// default: on the host the per-segment hand-off costs more than the end
+// pixels it saves, and it has not been measured on hardware. Both draw the
+// same pixels.
+extern int polylines;
+void render_set_polylines(int on);
+
+// --- Hidden-Line Removal ---
+// With hidden_lines on, an edge is dropped when every face next to it faces
+// away from the camera. Face sides come from the screen-space winding of
+// each quad, computed once per mesh per frame into vb->front.
+extern int hidden_lines;
+void render_set_hidden_lines(int on);
+void face_sides(const VertexBuffer* vb, const unsigned short (*faces)[4], int num_faces);
+// As draw_strips, skipping edges whose edge_faces (include/strip.h) are all back-facing.
+void draw_strips_hidden(const VertexBuffer* vb, const unsigned short* strips, int num_strips,
+                        const unsigned short (*edge_faces)[2], unsigned char color, EdgeStats* stats);
+void draw_strips8_hidden(const VertexBuffer* vb, const unsigned char* strips, int num_strips,
+                         const unsigned short (*edge_faces)[2], unsigned char color, EdgeStats* stats);
+
+// --- Solid Fill (source/solid.c) ---
+// With solid_fill on, meshes with faces are drawn as flat-shaded polygons
+// instead of edges: back faces are culled, the rest are sorted back to front
+// by a bucket sort on view depth and filled by the span rasterizer. Each
+// colour c owns the palette ramp c * SHADE_LEVELS .. c * SHADE_LEVELS +
+// SHADE_LEVELS - 1, darkest first, and a face takes the level its normal's
+// angle to a fixed light gives it. Needs vb->depth (face_order_alloc); in
+// the stats, accepted counts filled faces, hidden back faces, clipped faces
+// cut by the near plane and rejected faces wholly off screen.
+#define SHADE_LEVELS 16
+#define SHADE_AMBIENT 3 // Level of faces turned away from the light
+#define DEPTH_BUCKETS 128
+extern int solid_fill;
+void render_set_solid(int on);
+void shade_ramp(unsigned char color, unsigned short rgb); // Sets color's palette ramp up to rgb
+void draw_faces(const VertexBuffer* vb, const unsigned short (*faces)[4], int num_faces, unsigned char color, EdgeStats* stats);
+
+// Indices of the n keys from largest (farthest) to smallest, skipping keys
+// equal to DEPTH_SKIP; returns how many were written. A counting sort over
+// DEPTH_BUCKETS buckets spanning the keys' range: no comparisons, and keys
+// in the same bucket keep their index order.
+#define DEPTH_SKIP (-0x7FFFFFFF - 1)
+int depth_sort(const int* keys, int n, unsigned short* order);
+
+#endif // RENDER_H
@@ -0,0 +1,31 @@
+#ifndef REPLAY_H
+#define REPLAY_H
+
+// Input and animation recorder. The demo passes each frame's held keys and
+// animation phases through replay_frame(): while recording they are
+// appended to a caller-owned buffer, and while playing they are replaced by
+// the recorded frame, so a run can be repeated exactly under any build or
+// setting. Playback stops after the last frame and live input takes over;
+// recording stops when the buffer is full.
+enum ReplayMode { REPLAY_OFF, REPLAY_RECORD, REPLAY_PLAY };
+
+typedef struct {
+    unsigned short keys;        // Held, 1 = pressed
+    unsigned short angle_x;     // Model rotation, table steps
+    unsigned short angle_y;
+    unsigned short scene_angle; // Carousel, fine angle units
+    unsigned short pulse_angle; // Scale pulse, table steps
+    unsigned short anim_frame;  // Vertex animation pose
+} ReplayFrame;
+
+extern enum ReplayMode replay_mode;
+
+void replay_record(ReplayFrame* frames, int capacity);
+void replay_play(const ReplayFrame* frames, int count);
+void replay_stop(void);
+int replay_position(void); // Frames recorded, or played, since the last start
+
+// Records *frame, or overwrites it with the next recorded one.
+void replay_frame(ReplayFrame* frame);
+
+#endif // REPLAY_H
@@ -0,0 +1,45 @@
+#ifndef SCENE_H
+#define SCENE_H
+
+#include "transform.h"
+
+// Multi-object scenes. A Model is one mesh at up to MAX_MODEL_LODS
+// resolutions; an Instance places a model in view space with its own
+// rotation and colour. scene_draw() tests each instance's bounding sphere
+// against the view volume before any vertex is transformed, picks a
+// resolution from the sphere's projected radius, and then runs the usual
+// transform and strip stages into one shared vertex buffer, so vertex and
+// edge work scale with what is actually on screen.
+
+#define MAX_MODEL_LODS 3
+
+typedef struct {
+    int num_lods;
+    const Mesh* lods[MAX_MODEL_LODS];     // Finest first; lods[0]'s sphere bounds them all
+    short lod_pixels[MAX_MODEL_LODS - 1]; // lods[i] while the projected radius is >= lod_pixels[i]
+} Model;
+
+typedef struct {
+    const Model* model;
+    int x, y, z;                     // View-space position of the model origin
+    unsigned short angle_x, angle_y;
+    unsigned char color;
+} Instance;
+
+typedef struct {
+    int drawn, culled;
+    int lod_count[MAX_MODEL_LODS];
+    int vertices, edges; // Transformed and drawn this frame
+} SceneStats;
+
+// Projected bounding-sphere radius in pixels for mesh placed by m, or -1 when
+// the sphere lies entirely outside the view volume.
+int scene_project_radius(const Mesh* mesh, const Matrix3* m, enum CameraType camera);
+
+// Largest vertex and face counts among the instances' meshes: what the
+// vertex buffer passed to scene_draw() must hold.
+void scene_buffer_size(const Instance* instances, int num_instances, int* num_vertices, int* num_faces);
+void scene_draw(const Instance* instances, int num_instances, enum CameraType camera,
+                const VertexBuffer* vb, EdgeStats* edges, SceneStats* stats);
+
+#endif // SCENE_H
@@ -0,0 +1,16 @@
+#ifndef SECTIONS_H
+#define SECTIONS_H
+
+// Memory placement for the GBA linker script (gba.specs). On the host these
+// expand to nothing and everything lives in ordinary memory.
+#ifdef PLATFORM_HOST
+#define EWRAM_BSS
+#define IWRAM_DATA
+#define IWRAM_CODE
+#else
+#define EWRAM_BSS __attribute__((section(".sbss")))
+#define IWRAM_DATA __attribute__((section(".iwram")))
+#define IWRAM_CODE __attribute__((section(".iwram"), long_call))
+#endif
+
+#endif // SECTIONS_H
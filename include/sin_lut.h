@@ -1,180 +0,0 @@
-#ifndef SIN_LUT_H
-#define SIN_LUT_H
-
-// A 12-bit sine lookup table (4096 entries)
-const short sin_lut_12bit[4096] = {
-    0, 6, 13, 19, 25, 31, 38, 44, 50, 56, 62, 68, 74, 80, 86, 92,
-    98, 104, 110, 116, 122, 128, 134, 140, 146, 152, 158, 164, 170, 176, 182, 188,
-    194, 200, 206, 212, 218, 224, 230, 236, 242, 248, 254, 260, 266, 272, 278, 284,
-    290, 296, 302, 308, 314, 320, 326, 332, 338, 344, 350, 356, 362, 368, 374, 380,
-    386, 392, 398, 404, 410, 416, 422, 428, 434, 440, 446, 452, 458, 464, 470, 476,
-    482, 488, 494, 500, 506, 512, 518, 524, 530, 536, 542, 548, 554, 560, 566, 572,
-    578, 584, 590, 596, 602, 608, 614, 620, 626, 632, 638, 644, 650, 656, 662, 668,
-    674, 680, 686, 692, 698, 704, 710, 716, 722, 728, 734, 740, 746, 752, 758, 764,
-    770, 776, 782, 788, 794, 800, 806, 812, 818, 824, 830, 836, 842, 848, 854, 860,
-    866, 872, 878, 884, 890, 896, 902, 908, 914, 920, 926, 932, 938, 944, 950, 956,
-    962, 968, 974, 980, 986, 992, 998, 1004, 1010, 1016, 1022, 1028, 1034, 1040, 1046, 1052,
-    1058, 1064, 1070, 1076, 1082, 1088, 1094, 1100, 1106, 1112, 1118, 1124, 1130, 1136, 1142, 1148,
-    1154, 1160, 1166, 1172, 1178, 1184, 1190, 1196, 1202, 1208, 1214, 1220, 1226, 1232, 1238, 1244,
-    1250, 1256, 1262, 1268, 1274, 1280, 1286, 1292, 1298, 1304, 1310, 1316, 1322, 1328, 1334, 1340,
-    1346, 1352, 1358, 1364, 1370, 1376, 1382, 1388, 1394, 1400, 1406, 1412, 1418, 1424, 1430, 1436,
-    1442, 1448, 1454, 1460, 1466, 1472, 1478, 1484, 1490, 1496, 1502, 1508, 1514, 1520, 1526, 1532,
-    1538, 1544, 1550, 1556, 1562, 1568, 1574, 1580, 1586, 1592, 1598, 1604, 1610, 1616, 1622, 1628,
-    1634, 1640, 1646, 1652, 1658, 1664, 1670, 1676, 1682, 1688, 1694, 1700, 1706, 1712, 1718, 1724,
-    1730, 1736, 1742, 1748, 1754, 1760, 1766, 1772, 1778, 1784, 1790, 1796, 1802, 1808, 1814, 1820,
-    1826, 1832, 1838, 1844, 1850, 1856, 1862, 1868, 1874, 1880, 1886, 1892, 1898, 1904, 1910, 1916,
-    1922, 1928, 1934, 1940, 1946, 1952, 1958, 1964, 1970, 1976, 1982, 1988, 1994, 2000, 2006, 2012,
-    2018, 2024, 2030, 2036, 2042, 2048, 2054, 2060, 2066, 2072, 2078, 2084, 2090, 2096, 2102, 2108,
-    2114, 2120, 2126, 2132, 2138, 2144, 2150, 2156, 2162, 2168, 2174, 2180, 2186, 2192, 2198, 2204,
-    2210, 2216, 2222, 2228, 2234, 2240, 2246, 2252, 2258, 2264, 2270, 2276, 2282, 2288, 2294, 2300,
-    2306, 2312, 2318, 2324, 2330, 2336, 2342, 2348, 2354, 2360, 2366, 2372, 2378, 2384, 2390, 2396,
-    2402, 2408, 2414, 2420, 2426, 2432, 2438, 2444, 2450, 2456, 2462, 2468, 2474, 2480, 2486, 2492,
-    2498, 2504, 2510, 2516, 2522, 2528, 2534, 2540, 2546, 2552, 2558, 2564, 2570, 2576, 2582, 2588,
-    2594, 2600, 2606, 2612, 2618, 2624, 2630, 2636, 2642, 2648, 2654, 2660, 2666, 2672, 2678, 2684,
-    2690, 2696, 2702, 2708, 2714, 2720, 2726, 2732, 2738, 2744, 2750, 2756, 2762, 2768, 2774, 2780,
-    2786, 2792, 2798, 2804, 2810, 2816, 2822, 2828, 2834, 2840, 2846, 2852, 2858, 2864, 2870, 2876,
-    2882, 2888, 2894, 2900, 2906, 2912, 2918, 2924, 2930, 2936, 2942, 2948, 2954, 2960, 2966, 2972,
-    2978, 2984, 2990, 2996, 3002, 3008, 3014, 3020, 3026, 3032, 3038, 3044, 3050, 3056, 3062, 3068,
-    3074, 3080, 3086, 3092, 3098, 3104, 3110, 3116, 3122, 3128, 3134, 3140, 3146, 3152, 3158, 3164,
-    3170, 3176, 3182, 3188, 3194, 3200, 3206, 3212, 3218, 3224, 3230, 3236, 3242, 3248, 3254, 3260,
-    3266, 3272, 3278, 3284, 3290, 3296, 3302, 3308, 3314, 3320, 3326, 3332, 3338, 3344, 3350, 3356,
-    3362, 3368, 3374, 3380, 3386, 3392, 3398, 3404, 3410, 3416, 3422, 3428, 3434, 3440, 3446, 3452,
-    3458, 3464, 3470, 3476, 3482, 3488, 3494, 3500, 3506, 3512, 3518, 3524, 3530, 3536, 3542, 3548,
-    3554, 3560, 3566, 3572, 3578, 3584, 3590, 3596, 3602, 3608, 3614, 3620, 3626, 3632, 3638, 3644,
-    3650, 3656, 3662, 3668, 3674, 3680, 3686, 3692, 3698, 3704, 3710, 3716, 3722, 3728, 3734, 3740,
-    3746, 3752, 3758, 3764, 3770, 3776, 3782, 3788, 3794, 3800, 3806, 3812, 3818, 3824, 3830, 3836,
-    3842, 3848, 3854, 3860, 3866, 3872, 3878, 3884, 3890, 3896, 3902, 3908, 3914, 3920, 3926, 3932,
-    3938, 3944, 3950, 3956, 3962, 3968, 3974, 3980, 3986, 3992, 3998, 4004, 4010, 4016, 4022, 4028,
-    4034, 4040, 4046, 4052, 4058, 4064, 4070, 4076, 4082, 4088, 4094, 4096, 4096, 4096, 4096, 4096,
-    4096, 4096, 4096, 4096, 4096, 4096, 4094, 4088, 4082, 4076, 4070, 4064, 4058, 4052, 4046, 4040,
-    4034, 4028, 4022, 4016, 4010, 4004, 3998, 3992, 3986, 3980, 3974, 3968, 3962, 3956, 3950, 3944,
-    3938, 3932, 3926, 3920, 3914, 3908, 3902, 3896, 3890, 3884, 3878, 3872, 3866, 3860, 3854, 3848,
-    3842, 3836, 3830, 3824, 3818, 3812, 3806, 3800, 3794, 3788, 3782, 3776, 3770, 3764, 3758, 3752,
-    3746, 3740, 3734, 3728, 3722, 3716, 3710, 3704, 3698, 3692, 3686, 3680, 3674, 3668, 3662, 3656,
-    3650, 3644, 3638, 3632, 3626, 3620, 3614, 3608, 3602, 3596, 3590, 3584, 3578, 3572, 3566, 3560,
-    3554, 3548, 3542, 3536, 3530, 3524, 3518, 3512, 3506, 3500, 3494, 3488, 3482, 3476, 3470, 3464,
-    3458, 3452, 3446, 3440, 3434, 3428, 3422, 3416, 3410, 3404, 3398, 3392, 3386, 3380, 3374, 3368,
-    3362, 3356, 3350, 3344, 3338, 3332, 3326, 3320, 3314, 3308, 3302, 3296, 3290, 3284, 3278, 3272,
-    3266, 3260, 3254, 3248, 3242, 3236, 3230, 3224, 3218, 3212, 3206, 3200, 3194, 3188, 3182, 3176,
-    3170, 3164, 3158, 3152, 3146, 3140, 3134, 3128, 3122, 3116, 3110, 3104, 3098, 3092, 3086, 3080,
-    3074, 3068, 3062, 3056, 3050, 3044, 3038, 3032, 3026, 3020, 3014, 3008, 3002, 2996, 2990, 2984,
-    2978, 2972, 2966, 2960, 2954, 2948, 2942, 2936, 2930, 2924, 2918, 2912, 2906, 2900, 2894, 2888,
-    2882, 2876, 2870, 2864, 2858, 2852, 2846, 2840, 2834, 2828, 2822, 2816, 2810, 2804, 2798, 2792,
-    2786, 2780, 2774, 2768, 2762, 2756, 2750, 2744, 2738, 2732, 2726, 2720, 2714, 2708, 2702, 2696,
-    2690, 2684, 2678, 2672, 2666, 2660, 2654, 2648, 2642, 2636, 2630, 2624, 2618, 2612, 2606, 2600,
-    2594, 2588, 2582, 2576, 2570, 2564, 2558, 2552, 2546, 2540, 2534, 2528, 2522, 2516, 2510, 2504,
-    2498, 2492, 2486, 2480, 2474, 2468, 2462, 2456, 2450, 2444, 2438, 2432, 2426, 2420, 2414, 2408,
-    2402, 2396, 2390, 2384, 2378, 2372, 2366, 2360, 2354, 2348, 2342, 2336, 2330, 2324, 2318, 2312,
-    2306, 2300, 2294, 2288, 2282, 2276, 2270, 2264, 2258, 2252, 2246, 2240, 2234, 2228, 2222, 2216,
-    2210, 2204, 2198, 2192, 2186, 2180, 2174, 2168, 2162, 2156, 2150, 2144, 2138, 2132, 2126, 2120,
-    2114, 2108, 2102, 2096, 2090, 2084, 2078, 2072, 2066, 2060, 2054, 2048, 2042, 2036, 2030, 2024,
-    2018, 2012, 2006, 2000, 1994, 1988, 1982, 1976, 1970, 1964, 1958, 1952, 1946, 1940, 1934, 1928,
-    1922, 1916, 1910, 1904, 1898, 1892, 1886, 1880, 1874, 1868, 1862, 1856, 1850, 1844, 1838, 1832,
-    1826, 1820, 1814, 1808, 1802, 1796, 1790, 1784, 1778, 1772, 1766, 1760, 1754, 1748, 1742, 1736,
-    1730, 1724, 1718, 1712, 1706, 1700, 1694, 1688, 1682, 1676, 1670, 1664, 1658, 1652, 1646, 1640,
-    1634, 1628, 1622, 1616, 1610, 1604, 1598, 1592, 1586, 1580, 1574, 1568, 1562, 1556, 1550, 1544,
-    1538, 1532, 1526, 1520, 1514, 1508, 1502, 1496, 1490, 1484, 1478, 1472, 1466, 1460, 1454, 1448,
-    1442, 1436, 1430, 1424, 1418, 1412, 1406, 1400, 1394, 1388, 1382, 1376, 1370, 1364, 1358, 1352,
-    1346, 1340, 1334, 1328, 1322, 1316, 1310, 1304, 1298, 1292, 1286, 1280, 1274, 1268, 1262, 1256,
-    1250, 1244, 1238, 1232, 1226, 1220, 1214, 1208, 1202, 1196, 1190, 1184, 1178, 1172, 1166, 1160,
-    1154, 1148, 1142, 1136, 1130, 1124, 1118, 1112, 1106, 1100, 1094, 1088, 1082, 1076, 1070, 1064,
-    1058, 1052, 1046, 1040, 1034, 1028, 1022, 1016, 1010, 1004, 998, 992, 986, 980, 974, 968,
-    962, 956, 950, 944, 938, 932, 926, 920, 914, 908, 902, 896, 890, 884, 878, 872,
-    866, 860, 854, 848, 842, 836, 830, 824, 818, 812, 806, 800, 794, 788, 782, 776,
-    770, 764, 758, 752, 746, 740, 734, 728, 722, 716, 710, 704, 698, 692, 686, 680,
-    674, 668, 662, 656, 650, 644, 638, 632, 626, 620, 614, 608, 602, 596, 590, 584,
-    578, 572, 566, 560, 554, 548, 542, 536, 530, 524, 518, 512, 506, 500, 494, 488,
-    482, 476, 470, 464, 458, 452, 446, 440, 434, 428, 422, 416, 410, 404, 398, 392,
-    386, 380, 374, 368, 362, 356, 350, 344, 338, 332, 326, 320, 314, 308, 302, 296,
-    290, 284, 278, 272, 266, 260, 254, 248, 242, 236, 230, 224, 218, 212, 206, 200,
-    194, 188, 182, 176, 170, 164, 158, 152, 146, 140, 134, 128, 122, 116, 110, 104,
-    98, 92, 86, 80, 74, 68, 62, 56, 50, 44, 38, 31, 25, 19, 13, 6,
-    0, -6, -13, -19, -25, -31, -38, -44, -50, -56, -62, -68, -74, -80, -86, -92,
-    -98, -104, -110, -116, -122, -128, -134, -140, -146, -152, -158, -164, -170, -176, -182, -188,
-    -194, -200, -206, -212, -218, -224, -230, -236, -242, -248, -254, -260, -266, -272, -278, -284,
-    -290, -296, -302, -308, -314, -320, -326, -332, -338, -344, -350, -356, -362, -368, -374, -380,
-    -386, -392, -398, -404, -410, -416, -422, -428, -434, -440, -446, -452, -458, -464, -470, -476,
-    -482, -488, -494, -500, -506, -512, -518, -524, -530, -536, -542, -548, -554, -560, -566, -572,
-    -578, -584, -590, -596, -602, -608, -614, -620, -626, -632, -638, -644, -650, -656, -662, -668,
-    -674, -680, -686, -692, -698, -704, -710, -716, -722, -728, -734, -740, -746, -752, -758, -764,
-    -770, -776, -782, -788, -794, -800, -806, -812, -818, -824, -830, -836, -842, -848, -854, -860,
-    -866, -872, -878, -884, -890, -896, -902, -908, -914, -920, -926, -932, -938, -944, -950, -956,
-    -962, -968, -974, -980, -986, -992, -998, -1004, -1010, -1016, -1022, -1028, -1034, -1040, -1046, -1052,
-    -1058, -1064, -1070, -1076, -1082, -1088, -1094, -1100, -1106, -1112, -1118, -1124, -1130, -1136, -1142, -1148,
-    -1154, -1160, -1166, -1172, -1178, -1184, -1190, -1196, -1202, -1208, -1214, -1220, -1226, -1232, -1238, -1244,
-    -1250, -1256, -1262, -1268, -1274, -1280, -1286, -1292, -1298, -1304, -1310, -1316, -1322, -1328, -1334, -1340,
-    -1346, -1352, -1358, -1364, -1370, -1376, -1382, -1388, -1394, -1400, -1406, -1412, -1418, -1424, -1430, -1436,
-    -1442, -1448, -1454, -1460, -1466, -1472, -1478, -1484, -1490, -1496, -1502, -1508, -1514, -1520, -1526, -1532,
-    -1538, -1544, -1550, -1556, -1562, -1568, -1574, -1580, -1586, -1592, -1598, -1604, -1610, -1616, -1622, -1628,
-    -1634, -1640, -1646, -1652, -1658, -1664, -1670, -1676, -1682, -1688, -1694, -1700, -1706, -1712, -1718, -1724,
-    -1730, -1736, -1742, -1748, -1754, -1760, -1766, -1772, -1778, -1784, -1790, -1796, -1802, -1808, -1814, -1820,
-    -1826, -1832, -1838, -1844, -1850, -1856, -1862, -1868, -1874, -1880, -1886, -1892, -1898, -1904, -1910, -1916,
-    -1922, -1928, -1934, -1940, -1946, -1952, -1958, -1964, -1970, -1976, -1982, -1988, -1994, -2000, -2006, -2012,
-    -2018, -2024, -2030, -2036, -2042, -2048, -2054, -2060, -2066, -2072, -2078, -2084, -2090, -2096, -2102, -2108,
-    -2114, -2120, -2126, -2132, -2138, -2144, -2150, -2156, -2162, -2168, -2174, -2180, -2186, -2192, -2198, -2204,
-    -2210, -2216, -2222, -2228, -2234, -2240, -2246, -2252, -2258, -2264, -2270, -2276, -2282, -2288, -2294, -2300,
-    -2306, -2312, -2318, -2324, -2330, -2336, -2342, -2348, -2354, -2360, -2366, -2372, -2378, -2384, -2390, -2396,
-    -2402, -2408, -2414, -2420, -2426, -2432, -2438, -2444, -2450, -2456, -2462, -2468, -2474, -2480, -2486, -2492,
-    -2498, -2504, -2510, -2516, -2522, -2528, -2534, -2540, -2546, -2552, -2558, -2564, -2570, -2576, -2582, -2588,
-    -2594, -2600, -2606, -2612, -2618, -2624, -2630, -2636, -2642, -2648, -2654, -2660, -2666, -2672, -2678, -2684,
-    -2690, -2696, -2702, -2708, -2714, -2720, -2726, -2732, -2738, -2744, -2750, -2756, -2762, -2768, -2774, -2780,
-    -2786, -2792, -2798, -2804, -2810, -2816, -2822, -2828, -2834, -2840, -2846, -2852, -2858, -2864, -2870, -2876,
-    -2882, -2888, -2894, -2900, -2906, -2912, -2918, -2924, -2930, -2936, -2942, -2948, -2954, -2960, -2966, -2972,
-    -2978, -2984, -2990, -2996, -3002, -3008, -3014, -3020, -3026, -3032, -3038, -3044, -3050, -3056, -3062, -3068,
-    -3074, -3080, -3086, -3092, -3098, -3104, -3110, -3116, -3122, -3128, -3134, -3140, -3146, -3152, -3158, -3164,
-    -3170, -3176, -3182, -3188, -3194, -3200, -3206, -3212, -3218, -3224, -3230, -3236, -3242, -3248, -3254, -3260,
-    -3266, -3272, -3278, -3284, -3290, -3296, -3302, -3308, -3314, -3320, -3326, -3332, -3338, -3344, -3350, -3356,
-    -3362, -3368, -3374, -3380, -3386, -3392, -3398, -3404, -3410, -3416, -3422, -3428, -3434, -3440, -3446, -3452,
-    -3458, -3464, -3470, -3476, -3482, -3488, -3494, -3500, -3506, -3512, -3518, -3524, -3530, -3536, -3542, -3548,
-    -3554, -3560, -3566, -3572, -3578, -3584, -3590, -3596, -3602, -3608, -3614, -3620, -3626, -3632, -3638, -3644,
-    -3650, -3656, -3662, -3668, -3674, -3680, -3686, -3692, -3698, -3704, -3710, -3716, -3722, -3728, -3734, -3740,
-    -3746, -3752, -3758, -3764, -3770, -3776, -3782, -3788, -3794, -3800, -3806, -3812, -3818, -3824, -3830, -3836,
-    -3842, -3848, -3854, -3860, -3866, -3872, -3878, -3884, -3890, -3896, -3902, -3908, -3914, -3920, -3926, -3932,
-    -3938, -3944, -3950, -3956, -3962, -3968, -3974, -3980, -3986, -3992, -3998, -4004, -4010, -4016, -4022, -4028,
-    -4034, -4040, -4046, -4052, -4058, -4064, -4070, -4076, -4082, -4088, -4094, -4096, -4096, -4096, -4096, -4096,
-    -4096, -4096, -4096, -4096, -4096, -4096, -4094, -4088, -4082, -4076, -4070, -4064, -4058, -4052, -4046, -4040,
-    -4034, -4028, -4022, -4016, -4010, -4004, -3998, -3992, -3986, -3980, -3974, -3968, -3962, -3956, -3950, -3944,
-    -3938, -3932, -3926, -3920, -3914, -3908, -3902, -3896, -3890, -3884, -3878, -3872, -3866, -3860, -3854, -3848,
-    -3842, -3836, -3830, -3824, -3818, -3812, -3806, -3800, -3794, -3788, -3782, -3776, -3770, -3764, -3758, -3752,
-    -3746, -3740, -3734, -3728, -3722, -3716, -3710, -3704, -3698, -3692, -3686, -3680, -3674, -3668, -3662, -3656,
-    -3650, -3644, -3638, -3632, -3626, -3620, -3614, -3608, -3602, -3596, -3590, -3584, -3578, -3572, -3566, -3560,
-    -3554, -3548, -3542, -3536, -3530, -3524, -3518, -3512, -3506, -3500, -3494, -3488, -3482, -3476, -3470, -3464,
-    -3458, -3452, -3446, -3440, -3434, -3428, -3422, -3416, -3410, -3404, -3398, -3392, -3386, -3380, -3374, -3368,
-    -3362, -3356, -3350, -3344, -3338, -3332, -3326, -3320, -3314, -3308, -3302, -3296, -3290, -3284, -3278, -3272,
-    -3266, -3260, -3254, -3248, -3242, -3236, -3230, -3224, -3218, -3212, -3206, -3200, -3194, -3188, -3182, -3176,
-    -3170, -3164, -3158, -3152, -3146, -3140, -3134, -3128, -3122, -3116, -3110, -3104, -3098, -3092, -3086, -3080,
-    -3074, -3068, -3062, -3056, -3050, -3044, -3038, -3032, -3026, -3020, -3014, -3008, -3002, -2996, -2990, -2984,
-    -2978, -2972, -2966, -2960, -2954, -2948, -2942, -2936, -2930, -2924, -2918, -2912, -2906, -2900, -2894, -2888,
-    -2882, -2876, -2870, -2864, -2858, -2852, -2846, -2840, -2834, -2828, -2822, -2816, -2810, -2804, -2798, -2792,
-    -2786, -2780, -2774, -2768, -2762, -2756, -2750, -2744, -2738, -2732, -2726, -2720, -2714, -2708, -2702, -2696,
-    -2690, -2684, -2678, -2672, -2666, -2660, -2654, -2648, -2642, -2636, -2630, -2624, -2618, -2612, -2606, -2600,
-    -2594, -2588, -2582, -2576, -2570, -2564, -2558, -2552, -2546, -2540, -2534, -2528, -2522, -2516, -2510, -2504,
-    -2498, -2492, -2486, -2480, -2474, -2468, -2462, -2456, -2450, -2444, -2438, -2432, -2426, -2420, -2414, -2408,
-    -2402, -2396, -2390, -2384, -2378, -2372, -2366, -2360, -2354, -2348, -2342, -2336, -2330, -2324, -2318, -2312,
-    -2306, -2300, -2294, -2288, -2282, -2276, -2270, -2264, -2258, -2252, -2246, -2240, -2234, -2228, -2222, -2216,
-    -2210, -2204, -2198, -2192, -2186, -2180, -2174, -2168, -2162, -2156, -2150, -2144, -2138, -2132, -2126, -2120,
-    -2114, -2108, -2102, -2096, -2090, -2084, -2078, -2072, -2066, -2060, -2054, -2048, -2042, -2036, -2030, -2024,
-    -2018, -2012, -2006, -2000, -1994, -1988, -1982, -1976, -1970, -1964, -1958, -1952, -1946, -1940, -1934, -1928,
-    -1922, -1916, -1910, -1904, -1898, -1892, -1886, -1880, -1874, -1868, -1862, -1856, -1850, -1844, -1838, -1832,
-    -1826, -1820, -1814, -1808, -1802, -1796, -1790, -1784, -1778, -1772, -1766, -1760, -1754, -1748, -1742, -1736,
-    -1730, -1724, -1718, -1712, -1706, -1700, -1694, -1688, -1682, -1676, -1670, -1664, -1658, -1652, -1646, -1640,
-    -1634, -1628, -1622, -1616, -1610, -1604, -1598, -1592, -1586, -1580, -1574, -1568, -1562, -1556, -1550, -1544,
-    -1538, -1532, -1526, -1520, -1514, -1508, -1502, -1496, -1490, -1484, -1478, -1472, -1466, -1460, -1454, -1448,
-    -1442, -1436, -1430, -1424, -1418, -1412, -1406, -1400, -1394, -1388, -1382, -1376, -1370, -1364, -1358, -1352,
-    -1346, -1340, -1334, -1328, -1322, -1316, -1310, -1304, -1298, -1292, -1286, -1280, -1274, -1268, -1262, -1256,
-    -1250, -1244, -1238, -1232, -1226, -1220, -1214, -1208, -1202, -1196, -1190, -1184, -1178, -1172, -1166, -1160,
-    -1154, -1148, -1142, -1136, -1130, -1124, -1118, -1112, -1106, -1100, -1094, -1088, -1082, -1076, -1070, -1064,
-    -1058, -1052, -1046, -1040, -1034, -1028, -1022, -1016, -1010, -1004, -998, -992, -986, -980, -974, -968,
-    -962, -956, -950, -944, -938, -932, -926, -920, -914, -908, -902, -896, -890, -884, -878, -872,
-    -866, -860, -854, -848, -842, -836, -830, -824, -818, -812, -806, -800, -794, -788, -782, -776,
-    -770, -764, -758, -752, -746, -740, -734, -728, -722, -716, -710, -704, -698, -692, -686, -680,
-    -674, -668, -662, -656, -650, -644, -638, -632, -626, -620, -614, -608, -602, -596, -590, -584,
-    -578, -572, -566, -560, -554, -548, -542, -536, -530, -524, -518, -512, -506, -500, -494, -488,
-    -482, -476, -470, -464, -458, -452, -446, -440, -434, -428, -422, -416, -410, -404, -398, -392,
-    -386, -380, -374, -368, -362, -356, -350, -344, -338, -332, -326, -320, -314, -308, -302, -296,
-    -290, -284, -278, -272, -266, -260, -254, -248, -242, -236, -230, -224, -218, -212, -206, -200,
-    -194, -188, -182, -176, -170, -164, -158, -152, -146, -140, -134, -128, -122, -116, -110, -104,
-    -98, -92, -86, -80, -74, -68, -62, -56, -50, -44, -38, -31, -25, -19, -13, -6
-};
-
-#endif // SIN_LUT_H
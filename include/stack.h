@@ -0,0 +1,17 @@
+#ifndef STACK_H
+#define STACK_H
+
+// Stack high-water mark by painting. stack_paint() fills the free stack
+// below its caller's frame, down to plat_stack_limit() (the end of IWRAM
+// data on the GBA), with STACK_PAINT; stack_used() scans up from the limit
+// for the first word since overwritten. The scan covers all the stack never
+// reached, several KB, so it is meant for a once-a-second readout.
+
+#define STACK_PAINT 0x5AC35AC3u
+#define STACK_SLACK 64 // Bytes left unpainted below the caller, for stack_paint's own frame
+
+void stack_paint(void);
+unsigned int stack_used(void); // Deepest bytes below the caller of stack_paint(); 0 before it
+unsigned int stack_size(void); // Bytes from the limit up to that caller
+
+#endif // STACK_H
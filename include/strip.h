@@ -0,0 +1,42 @@
+#ifndef STRIP_H
+#define STRIP_H
+
+// Edge-strip path cover. An edge list is turned into strips: runs of vertex
+// indices drawn as connected polylines, so every interior vertex is fetched
+// and plotted once instead of once per edge that uses it.
+//
+// Strip stream layout: for each strip, its vertex count n (>= 2) followed by
+// n vertex indices; consecutive indices are one edge. Closed loops repeat
+// their first vertex at the end.
+//
+// Odd-degree vertices are paired with virtual edges so every vertex has
+// even degree, each connected component is walked as one Eulerian circuit
+// (Hierholzer), and the circuits are cut at the virtual edges. That gives
+// the minimum number of strips: one per component, or half its odd-degree
+// vertices when it has any. Shared by the runtime torus generator and the
+// offline converter in tools/objconv.c.
+
+// Scratch words and worst-case output entries for a mesh of nv vertices
+// and ne edges with strips of at most max_len vertices. Edge ids in the
+// scratch are u16: counting the virtual edges, at most 65536.
+#define STRIP_EDGES(nv, ne) ((ne) + (nv) / 2 + 1)
+#define STRIP_SCRATCH_WORDS(nv, ne) (2 * (nv) + 2 + STRIP_EDGES(nv, ne) / 32 + (5 * STRIP_EDGES(nv, ne) + 3) / 2)
+#define STRIP_MAX_ENTRIES(nv, ne, max_len) ((ne) + 2 * ((nv) + (ne) / ((max_len) - 1) + 1))
+
+// Returns the number of strips written to out and sets *out_entries, or -1
+// if capacity entries are not enough.
+int strip_build(const unsigned short (*edges)[2], int num_edges, int num_vertices, int max_len,
+                unsigned short* out, int capacity, int* out_entries, int* scratch);
+
+// Faces are quads of vertex indices; triangles repeat their last vertex.
+#define FACE_NONE 0xFFFF
+#define STRIP_FACE_SCRATCH_WORDS(nv, nf) (2 * (nv) + 1 + 4 * (nf))
+
+// Faces adjacent to each strip edge, in stream order: edge_faces[k] belongs
+// to the k-th consecutive index pair. An edge of one face gets FACE_NONE
+// second; an edge of no face, or of more than two, gets FACE_NONE twice and
+// is never hidden. Returns the number of edges written.
+int strip_edge_faces(const unsigned short* strips, int num_strips, const unsigned short (*faces)[4], int num_faces,
+                     int num_vertices, unsigned short (*edge_faces)[2], int* scratch);
+
+#endif // STRIP_H
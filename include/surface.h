@@ -0,0 +1,44 @@
+#ifndef SURFACE_H
+#define SURFACE_H
+
+// Parametric wireframe surfaces in fixed point, from the quarter-wave trig
+// table (include/trig.h). Shared by the runtime generator in source/mesh.c
+// and the build-time baker in tools/meshgen.c, so a mesh baked into ROM and
+// the same mesh generated on the device match bit for bit.
+//
+//   type      u, v segments          a, b
+//   torus     major x minor          major radius, minor radius
+//   sphere    slices x stacks        radius (poles on z)
+//   cylinder  around x bands         radius, half height (capped)
+//   grid      cells in x, y          half width, half height (z = 0)
+//   mobius    around x across        radius, half width
+//
+// Closed surfaces carry quad faces wound counter-clockwise seen from
+// outside (cap and pole triangles repeat their last vertex). The grid and
+// the Mobius strip are seen from both sides and have none, so hidden-line
+// removal never drops their edges. Every surface is centred on the origin.
+
+enum SurfaceType { SURFACE_TORUS, SURFACE_SPHERE, SURFACE_CYLINDER, SURFACE_GRID, SURFACE_MOBIUS, NUM_SURFACES };
+
+extern const char* const surface_names[NUM_SURFACES];
+
+typedef struct { int num_vertices, num_edges, num_faces; } SurfaceSize;
+
+// Element counts for these segment counts. Returns 0 if they are too small
+// for the type or the mesh would not fit u16 indices.
+int surface_size(enum SurfaceType type, int u, int v, SurfaceSize* size);
+
+// Writes the vertices, the (unique, undirected) edges and the faces into
+// arrays sized by surface_size(); faces may be 0 for a surface without.
+void surface_build(enum SurfaceType type, int u, int v, int a, int b, short* x, short* y, short* z,
+                   unsigned short (*edges)[2], unsigned short (*faces)[4]);
+
+// Torus vertices (same layout, so the torus edges and faces fit) whose tube
+// radius at major angle t is b + c sin(waves t + phase): c-high bulges
+// travelling round the ring as phase turns, for baked vertex animation.
+void surface_ripple(int u, int v, int a, int b, int c, int waves, unsigned int phase, short* x, short* y, short* z);
+
+// Bounding sphere radius around the origin, rounded up.
+int surface_radius(const short* x, const short* y, const short* z, int num_vertices);
+
+#endif // SURFACE_H
@@ -0,0 +1,46 @@
+#ifndef TRANSFORM_H
+#define TRANSFORM_H
+
+#include "render.h"
+#include "mesh.h"
+#include "anim.h"
+
+// Vertex transform stage. One fixed-point rotation matrix is built per
+// object and applied to the mesh's x/y/z streams in one pass; the pipeline
+// variant picks the kernel once for the whole mesh instead of testing the
+// camera once per vertex.
+// The kernels are ARM code placed in IWRAM (source/transform.iwram.c).
+// Each vertex also gets its clip outcode here, so the edge stage only
+// combines two bytes per edge.
+
+// Row-major rotation with FIXED_SHIFT + shift fraction bits, then a
+// view-space translation. shift is 0 until transform_mesh() folds in the
+// mesh's coordinate shift.
+typedef struct { int m[3][3]; int t[3]; int shift; } Matrix3;
+
+typedef void (*TransformKernel)(const short* x, const short* y, const short* z, int count, const Matrix3* m, const VertexBuffer* out);
+typedef void (*DeltaKernel)(const AnimPose* pose, int count, const Matrix3* m, const VertexBuffer* out);
+
+// Rotation about Y by angle_y, then about X by angle_x (4096 = full turn),
+// placed Z_OFFSET in front of the camera.
+void matrix_rotate_xy(Matrix3* m, unsigned int angle_x, unsigned int angle_y);
+
+// Scales the rotation uniformly by scale (FIXED_SHIFT fraction), leaving the
+// translation: folded in once per object, it costs nothing per vertex.
+void matrix_scale(Matrix3* m, int scale);
+
+// Indexed by a pipeline variant's PIPE_NEAR and PIPE_GUARD bits.
+#define NUM_TRANSFORM_KERNELS 4
+extern const TransformKernel transform_kernels[NUM_TRANSFORM_KERNELS];
+extern const DeltaKernel delta_kernels[NUM_TRANSFORM_KERNELS]; // For delta frames of an animation
+void transform_batch_perspective(const short* x, const short* y, const short* z, int count, const Matrix3* m, const VertexBuffer* out);
+void transform_batch_orthographic(const short* x, const short* y, const short* z, int count, const Matrix3* m, const VertexBuffer* out);
+void transform_batch_perspective_clip(const short* x, const short* y, const short* z, int count, const Matrix3* m, const VertexBuffer* out);
+void transform_batch_orthographic_clip(const short* x, const short* y, const short* z, int count, const Matrix3* m, const VertexBuffer* out);
+// With the kernel of pipe, the variant (pipeline_select) that will draw out,
+// and the mesh's coordinate shift folded into m.
+void transform_mesh(const Mesh* mesh, const Matrix3* m, const Pipeline* pipe, const VertexBuffer* out);
+// As transform_mesh, for one frame of a vertex animation (include/anim.h).
+void transform_pose(const AnimPose* pose, int num_vertices, const Matrix3* m, const Pipeline* pipe, const VertexBuffer* out);
+
+#endif // TRANSFORM_H
@@ -0,0 +1,40 @@
+#ifndef TRIG_H
+#define TRIG_H
+
+// Sine and cosine from one quarter-wave ROM table (2 KB instead of the
+// 8 KB a full-turn table costs). Angles are 4096 per turn; results carry
+// FIXED_SHIFT (12) fraction bits, so 4096 is 1.0.
+//
+// trig_sincos() folds the angle into the first quadrant with its two top
+// bits: odd quadrants read the table backwards and swap sin with cos, and
+// the sign of each follows from the quadrant. trig_sincos_fine() takes
+// TRIG_FINE_BITS more angle bits and interpolates linearly between the two
+// neighbouring table angles, for animation that moves by less than a step.
+//
+// host/check_trig.c checks every angle against libm.
+
+#define TRIG_ANGLES 4096
+#define TRIG_QUARTER (TRIG_ANGLES / 4)
+#define TRIG_FINE_BITS 4 // trig_sincos_fine: 65536 per turn
+
+typedef struct { short sin, cos; } SinCos;
+
+extern const short sin_quarter[TRIG_QUARTER + 1];
+
+static inline SinCos trig_sincos(unsigned int angle) {
+    unsigned int q = (angle / TRIG_QUARTER) & 3, i = angle & (TRIG_QUARTER - 1);
+    int a = sin_quarter[i], b = sin_quarter[TRIG_QUARTER - i];
+    int s = (q & 1) ? b : a, c = (q & 1) ? a : b;
+    SinCos r = { (q & 2) ? -s : s, ((q + 1) & 2) ? -c : c };
+    return r;
+}
+
+static inline SinCos trig_sincos_fine(unsigned int angle) {
+    unsigned int f = angle & ((1 << TRIG_FINE_BITS) - 1);
+    SinCos a = trig_sincos(angle >> TRIG_FINE_BITS), b = trig_sincos((angle >> TRIG_FINE_BITS) + 1);
+    const int half = 1 << (TRIG_FINE_BITS - 1), one = 1 << TRIG_FINE_BITS;
+    SinCos r = { (a.sin * (one - f) + b.sin * f + half) >> TRIG_FINE_BITS, (a.cos * (one - f) + b.cos * f + half) >> TRIG_FINE_BITS };
+    return r;
+}
+
+#endif // TRIG_H
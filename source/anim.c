@@ -0,0 +1,33 @@
+#include "anim.h"
+#include "animblob.h"
+
+Mesh ripple_mesh;
+VertexAnim ripple;
+
+int anim_load(VertexAnim* anim, const void* blob) {
+    const AnimBlobHeader* h = blob;
+    if (h->magic != ANIM_BLOB_MAGIC) return 0;
+    anim->num_vertices = h->num_vertices;
+    anim->num_frames = h->num_frames;
+    anim->base = blob;
+    anim->frame_offsets = (const unsigned int*)(anim->base + h->frame_offset);
+    return 1;
+}
+
+// Streams are padded to 4 bytes: 2n rounded up for keyframes, n for deltas.
+void anim_pose(const VertexAnim* anim, int frame, AnimPose* pose) {
+    int n = anim->num_vertices, key_stride = (2 * n + 3) & ~3, delta_stride = (n + 3) & ~3;
+    const AnimFrameHeader* h = (const AnimFrameHeader*)(anim->base + anim->frame_offsets[frame]);
+    const unsigned char* key = anim->base + anim->frame_offsets[h->key] + sizeof(AnimFrameHeader);
+    pose->x = (const short*)key;
+    pose->y = (const short*)(key + key_stride);
+    pose->z = (const short*)(key + 2 * key_stride);
+    if (h->key == frame) {
+        pose->dx = pose->dy = pose->dz = 0;
+        pose->shift = 0;
+    } else {
+        const signed char* d = (const signed char*)(h + 1);
+        pose->dx = d; pose->dy = d + delta_stride; pose->dz = d + 2 * delta_stride;
+        pose->shift = h->shift;
+    }
+}
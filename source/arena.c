@@ -0,0 +1,50 @@
+#include "arena.h"
+#include "sections.h"
+
+// Plain .bss is IWRAM on the GBA.
+static unsigned int iwram_pool[ARENA_IWRAM_BYTES / 4];
+static EWRAM_BSS unsigned int ewram_pool[ARENA_EWRAM_BYTES / 4];
+
+Arena arenas[NUM_ARENAS] = {
+    { (unsigned char*)iwram_pool, ARENA_IWRAM_BYTES, 0, 0, 0 },
+    { (unsigned char*)ewram_pool, ARENA_EWRAM_BYTES, 0, 0, 0 },
+};
+
+void arena_reset(void) {
+    for (int r = 0; r < NUM_ARENAS; r++) { arenas[r].used = 0; arenas[r].frame_used = 0; arenas[r].high_water = 0; }
+}
+
+static int arena_fits(Arena* a, unsigned int bytes) {
+    if (bytes > a->size - a->used - a->frame_used) return 0;
+    unsigned int total = a->used + a->frame_used + bytes;
+    if (total > a->high_water) a->high_water = total;
+    return 1;
+}
+
+void* arena_alloc(enum ArenaRegion region, unsigned int bytes) {
+    Arena* a = &arenas[region];
+    bytes = (bytes + 3) & ~3u;
+    if (!arena_fits(a, bytes)) return 0;
+    void* p = a->base + a->used;
+    a->used += bytes;
+    return p;
+}
+
+void* arena_frame_alloc(enum ArenaRegion region, unsigned int bytes) {
+    Arena* a = &arenas[region];
+    bytes = (bytes + 3) & ~3u;
+    if (!arena_fits(a, bytes)) return 0;
+    a->frame_used += bytes;
+    return a->base + a->size - a->frame_used;
+}
+
+void* arena_frame_alloc_any(unsigned int bytes) {
+    void* p = arena_frame_alloc(ARENA_IWRAM, bytes);
+    return p ? p : arena_frame_alloc(ARENA_EWRAM, bytes);
+}
+
+void arena_release(enum ArenaRegion region, unsigned int mark) { if (mark < arenas[region].used) arenas[region].used = mark; }
+
+void arena_frame_reset(void) {
+    for (int r = 0; r < NUM_ARENAS; r++) arenas[r].frame_used = 0;
+}
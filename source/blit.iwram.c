@@ -0,0 +1,19 @@
+#include <string.h>
+#include "framebuffer.h"
+#include "sections.h"
+
+// Eight words per load/store pair: one instruction fetch per 32 bytes, where
+// a Thumb loop pays one per word. Runs from IWRAM, so the fetches are free
+// of wait states as well.
+IWRAM_CODE void blit_words(volatile void* dst, const volatile void* src, int words) {
+#ifdef PLATFORM_HOST
+    memcpy((void*)dst, (const void*)src, words * 4);
+#else
+    volatile unsigned int* d = dst;
+    const volatile unsigned int* s = src;
+    for (int n = words >> 3; n; n--) {
+        asm volatile("ldmia %1!, {r3-r10}\n\tstmia %0!, {r3-r10}" : "+r"(d), "+r"(s) : : "r3", "r4", "r5", "r6", "r7", "r8", "r9", "r10", "memory");
+    }
+    if (words & 4) asm volatile("ldmia %1!, {r3-r6}\n\tstmia %0!, {r3-r6}" : "+r"(d), "+r"(s) : : "r3", "r4", "r5", "r6", "memory");
+#endif
+}
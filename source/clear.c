@@ -0,0 +1,112 @@
+#include "clear.h"
+#include "sections.h"
+
+typedef struct { short x0, y0, x1, y1; } ClearRect;
+
+typedef struct {
+    int full;      // Contents unknown: next clear must be a full one
+    int num_rects;
+    int num_lines;
+    ClearRect rects[CLEAR_MAX_RECTS];
+    ClearRect lines[CLEAR_MAX_LINES];
+} PageHistory;
+
+enum ClearMode clear_mode = CLEAR_FULL;
+static PageHistory page_history[NUM_PAGES] EWRAM_BSS;
+static PageHistory* current; // History of the page being drawn this frame
+
+void clear_set_mode(enum ClearMode mode) {
+    // Pages drawn under another mode may not have recorded everything.
+    clear_mode = mode;
+    for (int i = 0; i < NUM_PAGES; i++) page_history[i].full = 1;
+}
+
+static void clear_full(unsigned char color) { fb->clear(color); }
+
+// Rows covered by any rect get one span from the leftmost to the rightmost
+// rect edge on that row.
+static void clear_rect_spans(const PageHistory* h, unsigned char color) {
+    int y_min = SCREEN_Y_MAX, y_max = SCREEN_Y_MIN;
+    for (int i = 0; i < h->num_rects; i++) {
+        if (h->rects[i].y0 < y_min) y_min = h->rects[i].y0;
+        if (h->rects[i].y1 > y_max) y_max = h->rects[i].y1;
+    }
+    for (int y = y_min; y <= y_max; y++) {
+        int xa = SCREEN_X_MAX + 1, xb = -1;
+        for (int i = 0; i < h->num_rects; i++) {
+            const ClearRect* r = &h->rects[i];
+            if (y < r->y0 || y > r->y1) continue;
+            if (r->x0 < xa) xa = r->x0;
+            if (r->x1 > xb) xb = r->x1;
+        }
+        if (xa <= xb) draw_hspan(y, xa, xb, color);
+    }
+}
+
+void clear_frame(unsigned char color) {
+    PageHistory* h = &page_history[plat_page()];
+    if (h->full || clear_mode == CLEAR_FULL) {
+        clear_full(color);
+    } else {
+        if (clear_mode == CLEAR_ERASE) {
+            // Same rasterizer as the original draw, so exactly the same pixels.
+            for (int i = 0; i < h->num_lines; i++) draw_line_guarded(h->lines[i].x0, h->lines[i].y0, h->lines[i].x1, h->lines[i].y1, color);
+        }
+        clear_rect_spans(h, color);
+    }
+    h->full = 0; h->num_rects = 0; h->num_lines = 0;
+    current = h;
+}
+
+// Out of rects: grow the one whose area increases least to cover the new rect.
+static void merge_rect(PageHistory* h, int x0, int y0, int x1, int y1) {
+    ClearRect* best = &h->rects[0];
+    int best_growth = 0x7FFFFFFF;
+    for (int i = 0; i < h->num_rects; i++) {
+        ClearRect* r = &h->rects[i];
+        int ux0 = r->x0 < x0 ? r->x0 : x0, uy0 = r->y0 < y0 ? r->y0 : y0;
+        int ux1 = r->x1 > x1 ? r->x1 : x1, uy1 = r->y1 > y1 ? r->y1 : y1;
+        int growth = (ux1 - ux0 + 1) * (uy1 - uy0 + 1) - (r->x1 - r->x0 + 1) * (r->y1 - r->y0 + 1);
+        if (growth < best_growth) { best_growth = growth; best = r; }
+    }
+    if (x0 < best->x0) best->x0 = x0;
+    if (y0 < best->y0) best->y0 = y0;
+    if (x1 > best->x1) best->x1 = x1;
+    if (y1 > best->y1) best->y1 = y1;
+}
+
+void clear_mark_rect(int x0, int y0, int x1, int y1) {
+    if (x0 < SCREEN_X_MIN) x0 = SCREEN_X_MIN;
+    if (y0 < SCREEN_Y_MIN) y0 = SCREEN_Y_MIN;
+    if (x1 > SCREEN_X_MAX) x1 = SCREEN_X_MAX;
+    if (y1 > SCREEN_Y_MAX) y1 = SCREEN_Y_MAX;
+    if (!current || x0 > x1 || y0 > y1) return;
+    if (current->num_rects == CLEAR_MAX_RECTS) { merge_rect(current, x0, y0, x1, y1); return; }
+    ClearRect* r = &current->rects[current->num_rects++];
+    r->x0 = x0; r->y0 = y0; r->x1 = x1; r->y1 = y1;
+}
+
+// Screen-space bounds of a projected mesh; every line or face drawn from
+// these vertices after clipping stays inside it. Near-plane intersections can
+// land anywhere, so a mesh crossing the near plane marks the whole screen.
+// ERASE mode has no record of filled faces and needs the rect as well.
+void clear_mark_vertices(const VertexBuffer* vb, int num_vertices) {
+    if (clear_mode != CLEAR_DIRTY && !(clear_mode == CLEAR_ERASE && solid_fill)) return;
+    int x0 = SCREEN_X_MAX + 1, y0 = SCREEN_Y_MAX + 1, x1 = -1, y1 = -1;
+    for (int i = 0; i < num_vertices; i++) {
+        if (vb->codes[i] & CLIP_NEAR) { clear_mark_rect(SCREEN_X_MIN, SCREEN_Y_MIN, SCREEN_X_MAX, SCREEN_Y_MAX); return; }
+        const Point2D* p = &vb->screen[i];
+        if (p->x < x0) x0 = p->x;
+        if (p->x > x1) x1 = p->x;
+        if (p->y < y0) y0 = p->y;
+        if (p->y > y1) y1 = p->y;
+    }
+    clear_mark_rect(x0, y0, x1, y1);
+}
+
+void clear_record_line(int x0, int y0, int x1, int y1) {
+    if (!current) return;
+    if (current->num_lines == CLEAR_MAX_LINES) { current->full = 1; return; }
+    ClearRect* l = &current->lines[current->num_lines++];
+    l->x0 = x0; l->y0 = y0; l->x1 = x1; l->y1 = y1;
+}
@@ -0,0 +1,361 @@
+#include "demo.h"
+#include "clear.h"
+#include "hud.h"
+#include "transform.h"
+#include "profile.h"
+#include "present.h"
+#include "scene.h"
+#include "trig.h"
+#include "arena.h"
+#include "stack.h"
+#include "replay.h"
+
+// --- Demo State ---
+static enum ModelType current_model;
+static enum CameraType current_camera;
+static unsigned short last_keys;
+static unsigned int angle_x, angle_y, anim_angle;
+static EdgeStats edge_stats;
+static int frame_vertices; // Transformed this frame
+
+// --- Torus Detail ---
+// Finest-LOD segment counts UP cycles through; demo_set_torus() can pick
+// any others. The default is read from ROM when baked (include/mesh.h); the
+// rest are generated in the EWRAM arena above torus_mark.
+#define NUM_TORUS_DETAILS 3
+#define TORUS_DETAIL_DEFAULT 1
+static const unsigned char torus_details[NUM_TORUS_DETAILS][2] = { { 16, 8 }, { TORUS_MAJOR_SEGMENTS, TORUS_MINOR_SEGMENTS }, { 48, 24 } };
+static int torus_detail;
+static int torus_major, torus_minor; // Segment counts of torus_lods[0]
+static unsigned int torus_mark;
+
+// --- Surfaces ---
+// RIGHT cycles the single-model view between the torus and the other surfaces.
+static enum SurfaceType current_surface;
+static const char* const surface_labels[NUM_SURFACES] = { "TORUS", "SPHERE", "CYLINDER", "GRID", "MOBIUS" };
+
+// --- Animation ---
+// The single-model views pulse in size by a uniform scale folded into the
+// rotation matrix. The rippling torus also plays its baked vertex animation
+// (include/anim.h), one pose per frame.
+#define PULSE_SCALE 512 // Peak change, FIXED_SHIFT fraction (12.5%)
+#define PULSE_STEP 48   // Table steps per frame: about 1.4 s per pulse
+static unsigned int pulse_angle;
+static int ripple_frame;
+
+// --- Scene ---
+// Two rings of alternating cubes and tori turning around a point in front
+// of the camera, so instances sweep through every LOD and out of view.
+#define SCENE_RING 12
+#define SCENE_INSTANCES (2 * SCENE_RING)
+#define SCENE_RADIUS 300
+#define SCENE_DEPTH 450
+#define SCENE_ROW_Y 50
+#define SCENE_SPIN 40 // Carousel step per frame in fine angle units (2.5 table steps)
+static Model cube_model, torus_model;
+static Instance scene_instances[SCENE_INSTANCES];
+static SceneStats scene_stats;
+static const unsigned char scene_colors[3] = { 1, 3, 4 };
+
+// Black, white, green, yellow and cyan. All but the background also get a
+// shade ramp for solid fill; colour 0's would cover the others' entries.
+#define NUM_COLORS 5
+static const unsigned short colors[NUM_COLORS] = { 0x0000, 0x7FFF, 0x03E0, 0x7FE0, 0x03FF };
+
+// --- Solid Fill ---
+// LEFT toggles it; surfaces without faces stay wireframe.
+static int frame_solid; // This frame's mesh was filled: the HUD counts faces
+
+static unsigned int frame_count, total_ticks, fps;
+static unsigned int stack_bytes; // High-water mark, sampled with fps
+static unsigned int logic_ticks, render_ticks, wait_ticks;
+static int show_profile, profile_zone;
+
+static const char* const pacing_names[NUM_PACINGS] = { "60", "30", "MAX" };
+
+// HUD labels for the profiler page, indented by zone depth.
+static const char* const profile_labels[NUM_PROF_ZONES] = { "FRM", " CLR", " XFM", " RST", "  CL", " HUD", " PRS" };
+
+
+static int build_torus(int major, int minor) {
+    arena_release(ARENA_EWRAM, torus_mark);
+    if (!load_torus(major, minor) && !generate_torus(major, minor, TORUS_MAJOR_RADIUS, TORUS_MINOR_RADIUS)) return 0;
+    torus_major = major; torus_minor = minor;
+    return 1;
+}
+
+static void set_torus_detail(int detail) {
+    if (!build_torus(torus_details[detail][0], torus_details[detail][1])) {
+        detail = TORUS_DETAIL_DEFAULT;
+        build_torus(torus_details[detail][0], torus_details[detail][1]);
+    }
+    torus_detail = detail;
+}
+
+int demo_set_torus(int major, int minor) {
+    int old_major = torus_major, old_minor = torus_minor;
+    if (build_torus(major, minor)) return 1;
+    build_torus(old_major, old_minor); // Fitted before, over the same arena
+    return 0;
+}
+
+void demo_init(void) {
+    for (int c = 0; c < NUM_COLORS; c++) plat_set_palette(c, colors[c]);
+    for (int c = 1; c < NUM_COLORS; c++) shade_ramp(c, colors[c]);
+
+    hud_init(2);
+    arena_reset();
+    mesh_init();
+    torus_mark = arena_mark(ARENA_EWRAM);
+    set_torus_detail(TORUS_DETAIL_DEFAULT);
+    clear_set_mode(CLEAR_DEFAULT);
+    render_set_hidden_lines(0);
+    render_set_solid(0);
+    present_init();
+    fb_set_backend(FB_DEFAULT);
+
+    cube_model = (Model){ 1, { &cube_mesh }, { 0 } };
+    torus_model = (Model){ NUM_TORUS_LODS, { &torus_lods[0], &torus_lods[1], &torus_lods[2] }, { 48, 20 } };
+    for (int i = 0; i < SCENE_INSTANCES; i++) {
+        scene_instances[i] = (Instance){ (i & 1) ? &cube_model : &torus_model, 0, (i < SCENE_RING) ? -SCENE_ROW_Y : SCENE_ROW_Y, 0, 0, 0, scene_colors[i % 3] };
+    }
+
+    current_model = MODEL_CUBE;
+    current_surface = SURFACE_TORUS;
+    current_camera = CAMERA_PERSPECTIVE;
+    last_keys = 0;
+    angle_x = 0; angle_y = 0; anim_angle = 0;
+    pulse_angle = 0; ripple_frame = 0;
+    frame_count = 0; total_ticks = 0; fps = 0; stack_bytes = 0;
+    logic_ticks = 0; render_ticks = 0; wait_ticks = 0;
+    show_profile = 0; profile_zone = 0;
+    prof_reset();
+}
+
+void demo_work(int* vertices, EdgeStats* stats) {
+    *vertices = frame_vertices;
+    *stats = edge_stats;
+}
+
+static void hud_stats(void) {
+    hud_line_uint(0, "FPS: ", fps);
+    hud_line_ms(1, "LOGIC: ", logic_ticks);
+    hud_line_ms(2, "RENDER: ", render_ticks);
+    hud_line_ms(3, "WAIT: ", wait_ticks);
+    char text[HUD_MAX_CHARS + 1];
+    char* p = hud_put_str(hud_put_str(text, (current_camera == CAMERA_PERSPECTIVE) ? "CAM: PERSP" : "CAM: ORTHO"), " PACE:");
+    p = hud_put_str(hud_put_str(hud_put_str(p, pacing_names[frame_pacing]), " FB:"), fb->name);
+    *p = 0; hud_line_text(4, text);
+    if (frame_solid) {
+        p = hud_put_uint(hud_put_str(text, "FILL:"), edge_stats.accepted);
+        p = hud_put_uint(hud_put_str(p, " BACK:"), edge_stats.hidden);
+        *p = 0; hud_line_text(5, text);
+        p = hud_put_uint(hud_put_str(text, "NEAR:"), edge_stats.clipped);
+        p = hud_put_uint(hud_put_str(p, " REJ:"), edge_stats.rejected);
+        *p = 0; hud_line_text(6, text);
+    } else {
+        p = hud_put_uint(hud_put_str(text, "ACC:"), edge_stats.accepted);
+        p = hud_put_uint(hud_put_str(p, " GB:"), edge_stats.guarded);
+        *p = 0; hud_line_text(5, text);
+        p = hud_put_uint(hud_put_str(text, "CLP:"), edge_stats.clipped);
+        p = hud_put_uint(hud_put_str(p, " REJ:"), edge_stats.rejected);
+        if (hidden_lines) p = hud_put_uint(hud_put_str(p, " HID:"), edge_stats.hidden);
+        *p = 0; hud_line_text(6, text);
+    }
+    if (current_model == MODEL_SCENE) {
+        p = hud_put_uint(hud_put_str(text, "OBJ:"), scene_stats.drawn);
+        p = hud_put_uint(hud_put_str(p, "/"), SCENE_INSTANCES);
+        p = hud_put_uint(hud_put_str(p, " L:"), scene_stats.lod_count[0]);
+        p = hud_put_uint(hud_put_str(p, "/"), scene_stats.lod_count[1]);
+        p = hud_put_uint(hud_put_str(p, "/"), scene_stats.lod_count[2]);
+        p = hud_put_uint(hud_put_str(p, " V:"), scene_stats.vertices);
+    } else {
+        if (current_model == MODEL_RIPPLE) {
+            p = hud_put_uint(hud_put_str(text, "ANIM:"), ripple_frame);
+            p = hud_put_uint(hud_put_str(p, "/"), ripple.num_frames);
+        } else if (current_model == MODEL_TORUS && current_surface != SURFACE_TORUS) {
+            p = hud_put_str(text, surface_labels[current_surface]);
+        } else {
+            p = hud_put_uint(hud_put_str(text, "SEG:"), torus_major);
+            p = hud_put_uint(hud_put_str(p, "x"), torus_minor);
+        }
+        p = hud_put_uint(hud_put_str(p, " IW:"), arenas[ARENA_IWRAM].high_water);
+        p = hud_put_uint(hud_put_str(p, " EW:"), arenas[ARENA_EWRAM].high_water);
+    }
+    *p = 0; hud_line_text(7, text);
+}
+
+// Place every instance on its ring for this frame's carousel angle.
+static void scene_update(void) {
+    for (int i = 0; i < SCENE_INSTANCES; i++) {
+        Instance* inst = &scene_instances[i];
+        int slot = (i < SCENE_RING) ? i : i - SCENE_RING;
+        unsigned int theta = (((slot * 2 + (i >= SCENE_RING)) * TRIG_ANGLES / (2 * SCENE_RING)) << TRIG_FINE_BITS) + anim_angle;
+        SinCos sc = trig_sincos_fine(theta);
+        inst->x = (SCENE_RADIUS * sc.sin) >> FIXED_SHIFT;
+        inst->z = SCENE_DEPTH + ((SCENE_RADIUS * sc.cos) >> FIXED_SHIFT);
+        inst->angle_x = (angle_x + i * 341) & 4095;
+        inst->angle_y = (angle_y + i * 173) & 4095;
+    }
+}
+
+// Right-aligned ms field for the profiler page.
+static char* put_ms_field(char* p, unsigned int ticks) {
+    char digits[12];
+    int n = hud_put_ms(digits, ticks) - digits;
+    for (int i = n; i < 6; i++) *p++ = ' ';
+    for (int i = 0; i < n; i++) *p++ = digits[i];
+    return p;
+}
+
+// Profiler page: min/avg/max/p99 per zone over the ring and the stack
+// high-water mark. One zone is refreshed per frame so the scan never costs
+// more than one pass.
+static void hud_profile(void) {
+    hud_line_text(0, "ZONE   MIN   AVG   MAX   P99");
+    ProfStats st;
+    prof_stats(profile_zone, &st);
+    char text[HUD_MAX_CHARS + 1];
+    char* p = hud_put_str(text, profile_labels[profile_zone]);
+    while (p < text + 4) *p++ = ' ';
+    p = put_ms_field(put_ms_field(put_ms_field(put_ms_field(p, st.min), st.avg), st.max), st.p99);
+    *p = 0; hud_line_text(1 + profile_zone, text);
+    p = hud_put_uint(hud_put_str(text, "STACK: "), stack_bytes);
+    p = hud_put_uint(hud_put_str(p, "/"), stack_size());
+    *p = 0; hud_line_text(1 + NUM_PROF_ZONES, text);
+    profile_zone = (profile_zone + 1 == NUM_PROF_ZONES) ? 0 : profile_zone + 1;
+}
+
+
+void demo_frame(void) {
+    PROF_BEGIN(PROF_FRAME);
+    unsigned int start_tick = plat_ticks();
+    arena_frame_reset();
+
+    // --- Input ---
+    // Keys and animation phases go through the recorder (include/replay.h).
+    ReplayFrame input = { plat_keys(), angle_x, angle_y, anim_angle, pulse_angle, ripple_frame };
+    replay_frame(&input);
+    unsigned short current_keys = input.keys;
+    angle_x = input.angle_x; angle_y = input.angle_y; anim_angle = input.scene_angle;
+    pulse_angle = input.pulse_angle; ripple_frame = input.anim_frame;
+    if ((current_keys & KEY_A) && !(last_keys & KEY_A)) {
+        current_model = (current_model + 1) % NUM_MODELS;
+    }
+    if ((current_keys & KEY_B) && !(last_keys & KEY_B)) {
+        current_camera = (current_camera == CAMERA_PERSPECTIVE) ? CAMERA_ORTHOGRAPHIC : CAMERA_PERSPECTIVE;
+    }
+    if ((current_keys & KEY_SELECT) && !(last_keys & KEY_SELECT)) {
+        clear_set_mode((clear_mode + 1) % NUM_CLEAR_MODES);
+    }
+    if ((current_keys & KEY_R) && !(last_keys & KEY_R)) {
+        render_set_hidden_lines(!hidden_lines);
+    }
+    if ((current_keys & KEY_L) && !(last_keys & KEY_L)) {
+        present_set_pacing((frame_pacing + 1) % NUM_PACINGS);
+    }
+    if ((current_keys & KEY_RIGHT) && !(last_keys & KEY_RIGHT)) {
+        current_surface = (current_surface + 1) % NUM_SURFACES;
+    }
+    if ((current_keys & KEY_LEFT) && !(last_keys & KEY_LEFT)) {
+        render_set_solid(!solid_fill);
+    }
+    if ((current_keys & KEY_UP) && !(last_keys & KEY_UP)) {
+        set_torus_detail((torus_detail + 1) % NUM_TORUS_DETAILS);
+    }
+    if ((current_keys & KEY_DOWN) && !(last_keys & KEY_DOWN)) {
+        fb_set_backend((fb - fb_backends + 1) % NUM_FB_BACKENDS);
+    }
+    if ((current_keys & KEY_START) && !(last_keys & KEY_START)) {
+        show_profile = !show_profile;
+        for (int i = 0; i < HUD_MAX_LINES; i++) hud_line_text(i, "");
+    }
+    last_keys = current_keys;
+
+    // --- Logic ---
+    // The specialized transform and edge stages for this frame's camera,
+    // guard band and backend.
+    const Pipeline* pipe = pipeline_select(current_camera);
+    PROF_BEGIN(PROF_CLEAR);
+    clear_frame(0);
+    PROF_END(PROF_CLEAR);
+    Matrix3 rotation;
+    matrix_rotate_xy(&rotation, angle_x, angle_y);
+    matrix_scale(&rotation, (1 << FIXED_SHIFT) + ((PULSE_SCALE * trig_sincos(pulse_angle).sin) >> FIXED_SHIFT));
+    const Mesh* mesh = (current_model == MODEL_CUBE) ? &cube_mesh
+                     : (current_model == MODEL_RIPPLE) ? &ripple_mesh
+                     : (current_surface == SURFACE_TORUS) ? &torus_lods[TORUS_LOD_DEFAULT] : &surface_meshes[current_surface];
+    int buffer_vertices = mesh->num_vertices, buffer_faces = mesh->num_faces;
+    if (current_model == MODEL_SCENE) {
+        scene_update();
+        scene_buffer_size(scene_instances, SCENE_INSTANCES, &buffer_vertices, &buffer_faces);
+    }
+    VertexBuffer vertices;
+    int have_buffer = vertex_buffer_alloc(&vertices, buffer_vertices, buffer_faces);
+    // Without room for the face order, solid meshes fall back to wireframe.
+    frame_solid = have_buffer && solid_fill && buffer_faces && face_order_alloc(&vertices, buffer_faces);
+
+    unsigned int logic_end_tick = plat_ticks();
+
+    // --- Render ---
+    // Without a vertex buffer (both arenas full) the frame stays empty.
+    edge_stats = (EdgeStats){ 0, 0, 0, 0, 0 };
+    frame_vertices = 0;
+    if (have_buffer && current_model == MODEL_SCENE) {
+        scene_draw(scene_instances, SCENE_INSTANCES, current_camera, &vertices, &edge_stats, &scene_stats);
+        frame_vertices = scene_stats.vertices;
+    } else if (have_buffer) {
+        frame_vertices = mesh->num_vertices;
+        PROF_BEGIN(PROF_TRANSFORM);
+        if (current_model == MODEL_RIPPLE) {
+            AnimPose pose;
+            anim_pose(&ripple, ripple_frame, &pose);
+            transform_pose(&pose, mesh->num_vertices, &rotation, pipe, &vertices);
+        } else {
+            transform_mesh(mesh, &rotation, pipe, &vertices);
+        }
+        clear_mark_vertices(&vertices, mesh->num_vertices);
+        PROF_END(PROF_TRANSFORM);
+        PROF_BEGIN(PROF_RASTER);
+        draw_mesh(mesh, pipe, &vertices, 1, &edge_stats);
+        PROF_END(PROF_RASTER);
+    }
+
+    unsigned int render_end_tick = plat_ticks();
+
+    // --- Draw HUD ---
+    // Shows the previous frame's timings: this one is not over yet.
+    PROF_BEGIN(PROF_HUD);
+    if (show_profile) hud_profile(); else hud_stats();
+    hud_draw();
+    PROF_END(PROF_HUD);
+
+    // --- Present & Timing ---
+    unsigned int present_tick = plat_ticks();
+    PROF_BEGIN(PROF_PRESENT);
+    present_frame();
+    PROF_END(PROF_PRESENT);
+    unsigned int frame_end_tick = plat_ticks();
+
+    logic_ticks = logic_end_tick - start_tick;
+    render_ticks = render_end_tick - logic_end_tick;
+    wait_ticks = frame_end_tick - present_tick;
+
+    frame_count++;
+    total_ticks += frame_end_tick - start_tick;
+    if (frame_count >= 60) {
+        if (total_ticks > 0) { fps = (60 * GBA_CLOCK_FREQ) / total_ticks; }
+        stack_bytes = stack_used();
+        frame_count = 0; total_ticks = 0;
+    }
+
+    PROF_END(PROF_FRAME);
+    prof_end_frame();
+
+    // --- Update angles for next frame ---
+    angle_x = (angle_x + 32) & 4095;
+    angle_y = (angle_y + 16) & 4095;
+    anim_angle = (anim_angle + SCENE_SPIN) & ((TRIG_ANGLES << TRIG_FINE_BITS) - 1);
+    pulse_angle = (pulse_angle + PULSE_STEP) & (TRIG_ANGLES - 1);
+    ripple_frame = (ripple_frame + 1 == ripple.num_frames) ? 0 : ripple_frame + 1;
+}
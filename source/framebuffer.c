@@ -0,0 +1,42 @@
+#include "framebuffer.h"
+#include "clear.h"
+#include "present.h"
+
+const FbBackend* fb = &fb_backends[FB_DEFAULT];
+int fb_row_min = SCREEN_Y_MIN, fb_row_max = SCREEN_Y_MAX;
+
+// Rows each VRAM page is missing: drawn into the offscreen page since that
+// VRAM page was last filled. Empty when min > max.
+static int pending_min[NUM_VRAM_PAGES], pending_max[NUM_VRAM_PAGES];
+
+static void clear_vram(unsigned char color) { plat_fill32(back_buffer, color * 0x01010101u, PAGE_BYTES / 4); }
+static void clear_offscreen(unsigned char color) { fb_touch_rows(SCREEN_Y_MIN, SCREEN_Y_MAX); clear_vram(color); }
+
+static void present_dma(int vram_page) { plat_copy_rows(vram_page, SCREEN_Y_MIN, SCREEN_Y_MAX); }
+static void present_ldm(int vram_page) { blit_words(plat_vram_page(vram_page), back_buffer, PAGE_BYTES / 4); }
+
+// With an incremental clear only the rows under this and the previous
+// frame's drawing change, often far less than the whole page.
+static void present_rows(int vram_page) {
+    for (int p = 0; p < NUM_VRAM_PAGES; p++) {
+        if (fb_row_min < pending_min[p]) pending_min[p] = fb_row_min;
+        if (fb_row_max > pending_max[p]) pending_max[p] = fb_row_max;
+    }
+    if (pending_min[vram_page] <= pending_max[vram_page]) plat_copy_rows(vram_page, pending_min[vram_page], pending_max[vram_page]);
+    pending_min[vram_page] = SCREEN_Y_MAX + 1; pending_max[vram_page] = -1;
+    fb_row_min = SCREEN_Y_MAX + 1; fb_row_max = -1;
+}
+
+const FbBackend fb_backends[NUM_FB_BACKENDS] = {
+    { "VRAM", 0, clear_vram, raster_hspan_vram, raster_pixel_vram, raster_line_vram, raster_fill_vram, 0 },
+    { "DMA", 1, clear_offscreen, raster_hspan_bytes, raster_pixel_bytes, raster_line_bytes, raster_fill_bytes, present_dma },
+    { "LDM", 1, clear_offscreen, raster_hspan_bytes, raster_pixel_bytes, raster_line_bytes, raster_fill_bytes, present_ldm },
+    { "ROWS", 1, clear_offscreen, raster_hspan_bytes, raster_pixel_bytes, raster_line_bytes, raster_fill_bytes, present_rows },
+};
+
+void fb_set_backend(enum FbBackendId id) {
+    fb = &fb_backends[id];
+    for (int p = 0; p < NUM_VRAM_PAGES; p++) { pending_min[p] = SCREEN_Y_MIN; pending_max[p] = SCREEN_Y_MAX; }
+    present_retarget();
+    clear_set_mode(clear_mode); // The new target's contents are unknown
+}
@@ -0,0 +1,122 @@
+#include "hud.h"
+#include "platform.h"
+#include "clear.h"
+#include "sections.h"
+#include "font.h"
+#include "recip.h"
+
+#define HUD_WORDS_PER_ROW (HUD_MAX_CHARS * 2) // 8 pixels per char, 4 per word
+
+typedef struct {
+    const char* label;     // Label/value pair last rasterized, to skip
+    unsigned int value;    // re-formatting when nothing changed
+    int kind;
+    char text[HUD_MAX_CHARS + 1];
+    int words;             // Used width of pixels[] in words
+    unsigned int pixels[8][HUD_WORDS_PER_ROW];
+} HudLine;
+
+enum { HUD_KIND_NONE, HUD_KIND_TEXT, HUD_KIND_UINT, HUD_KIND_MS };
+
+static HudLine hud_lines[HUD_MAX_LINES] EWRAM_BSS;
+static unsigned int nibble_words[16]; // 4-pixel 8bpp strip for each glyph nibble
+
+// --- Formatting ---
+char* hud_put_str(char* p, const char* s) { while (*s) *p++ = *s++; return p; }
+
+// Digits come from 32-bit reciprocal multiplies, so neither a library
+// divide nor a long multiply is pulled in: (v * 0xCCCD) >> 19 equals v / 10
+// for v < 81920, and past that (v / 2) / 5 goes through recip_mul_shr().
+char* hud_put_uint(char* p, unsigned int value) {
+    char digits[10];
+    int n = 0;
+    do {
+        unsigned int q = value < 81920 ? (value * 0xCCCDu) >> 19 : (unsigned int)recip_mul_shr(value >> 1, 0x66666667u, 33);
+        digits[n++] = '0' + (value - q * 10);
+        value = q;
+    } while (value);
+    while (n) *p++ = digits[--n];
+    return p;
+}
+
+// Timer ticks as milliseconds with two decimals: ticks * 100000 / 2^24,
+// that is ticks * 3125 / 2^19, gives hundredths of a millisecond.
+char* hud_put_ms(char* p, unsigned int ticks) {
+    unsigned int hundredths = recip_mul_shr(ticks, 3125, 19);
+    unsigned int whole = recip_mul_shr(hundredths, 0x51EB851Fu, 37); // / 100
+    unsigned int frac = hundredths - whole * 100;
+    p = hud_put_uint(p, whole);
+    *p++ = '.';
+    unsigned int tens = (frac * 205) >> 11; // / 10 for frac < 1029
+    *p++ = '0' + tens;
+    *p++ = '0' + (frac - tens * 10);
+    return p;
+}
+
+// --- Rasterization ---
+void hud_init(unsigned char color) {
+    for (int n = 0; n < 16; n++) {
+        unsigned int w = 0;
+        for (int k = 0; k < 4; k++) if (n & (8 >> k)) w |= (unsigned int)color << (8 * k);
+        nibble_words[n] = w;
+    }
+    for (int i = 0; i < HUD_MAX_LINES; i++) { hud_lines[i].kind = HUD_KIND_NONE; hud_lines[i].text[0] = 0; hud_lines[i].words = 0; }
+}
+
+static void rasterize_line(HudLine* l, const char* text, int len) {
+    for (int c = 0; c < len; c++) {
+        const unsigned char* glyph = font_data[text[c] & 127];
+        for (int row = 0; row < 8; row++) {
+            l->pixels[row][c * 2] = nibble_words[glyph[row] >> 4];
+            l->pixels[row][c * 2 + 1] = nibble_words[glyph[row] & 15];
+        }
+    }
+    l->words = len * 2;
+}
+
+static void set_line(int line, const char* text, int len) {
+    HudLine* l = &hud_lines[line];
+    if (len > HUD_MAX_CHARS) len = HUD_MAX_CHARS;
+    int same = (l->words == len * 2);
+    for (int c = 0; same && c < len; c++) same = (l->text[c] == text[c]);
+    if (same) return;
+    for (int c = 0; c < len; c++) l->text[c] = text[c];
+    l->text[len] = 0;
+    rasterize_line(l, text, len);
+}
+
+void hud_line_text(int line, const char* text) {
+    int len = 0;
+    while (text[len]) len++;
+    hud_lines[line].kind = HUD_KIND_TEXT;
+    set_line(line, text, len);
+}
+
+static void line_value(int line, int kind, const char* label, unsigned int value) {
+    HudLine* l = &hud_lines[line];
+    if (l->kind == kind && l->label == label && l->value == value) return;
+    char buffer[HUD_MAX_CHARS + 12];
+    char* p = hud_put_str(buffer, label);
+    p = (kind == HUD_KIND_MS) ? hud_put_str(hud_put_ms(p, value), "ms") : hud_put_uint(p, value);
+    l->kind = kind; l->label = label; l->value = value;
+    set_line(line, buffer, p - buffer);
+}
+
+void hud_line_uint(int line, const char* label, unsigned int value) { line_value(line, HUD_KIND_UINT, label, value); }
+void hud_line_ms(int line, const char* label, unsigned int ticks) { line_value(line, HUD_KIND_MS, label, ticks); }
+
+// --- Blit ---
+void hud_draw(void) {
+    for (int i = 0; i < HUD_MAX_LINES; i++) {
+        const HudLine* l = &hud_lines[i];
+        if (!l->words) continue;
+        int y = HUD_Y + i * HUD_LINE_SPACING;
+        for (int row = 0; row < 8; row++) {
+            volatile unsigned int* dst = (volatile unsigned int*)(back_buffer + (y + row) * (SCREEN_WIDTH / 2) + HUD_X / 2);
+            const unsigned int* src = l->pixels[row];
+            for (int w = 0; w < l->words; w++) dst[w] = src[w];
+        }
+        clear_mark_rect(HUD_X, y, HUD_X + l->words * 4 - 1, y + 7);
+        fb_touch_rows(y, y + 7);
+    }
+}
@@ -0,0 +1,127 @@
+#include "mesh.h"
+#include "render.h"
+#include "meshblob.h"
+#include "strip.h"
+#include "arena.h"
+#include "anim.h"
+
+// --- Cube Model Data ---
+Mesh cube_mesh;
+
+int mesh_load(Mesh* mesh, const void* blob) {
+    const MeshBlobHeader* h = blob;
+    const char* base = blob;
+    if (h->magic != MESH_BLOB_MAGIC) return 0;
+    mesh->num_vertices = h->num_vertices;
+    mesh->num_edges = h->num_edges;
+    mesh->x = (const short*)(base + h->x_offset);
+    mesh->y = (const short*)(base + h->y_offset);
+    mesh->z = (const short*)(base + h->z_offset);
+    mesh->num_strips = h->num_strips;
+    mesh->strips = (h->index_size == 2) ? (const unsigned short*)(base + h->strip_offset) : 0;
+    mesh->strips8 = (h->index_size == 1) ? (const unsigned char*)(base + h->strip_offset) : 0;
+    mesh->radius = h->radius;
+    mesh->shift = h->shift;
+    for (int i = 0; i < 3; i++) mesh->center[i] = h->center[i];
+    mesh->num_faces = h->num_faces;
+    mesh->faces = h->num_faces ? (const unsigned short (*)[4])(base + h->face_offset) : 0;
+    mesh->edge_faces = h->num_faces ? (const unsigned short (*)[2])(base + h->edge_face_offset) : 0;
+    return 1;
+}
+
+// --- Torus Model Data ---
+Mesh torus_lods[NUM_TORUS_LODS];
+
+// --- Surface Model Data ---
+// Baked by the Makefile's SURFACE_* rules with the same arguments.
+const SurfaceParams surface_params[NUM_SURFACES] = {
+    { TORUS_MAJOR_SEGMENTS, TORUS_MINOR_SEGMENTS, TORUS_MAJOR_RADIUS, TORUS_MINOR_RADIUS },
+    { 16, 12, 60, 0 },
+    { 16, 4, 40, 50 },
+    { 10, 10, 60, 40 },
+    { 48, 4, 50, 20 },
+};
+Mesh surface_meshes[NUM_SURFACES];
+
+#if BAKED_MESHES
+static const unsigned int* const surface_blobs[NUM_SURFACES] = { 0, sphere_blob, cylinder_blob, grid_blob, mobius_blob };
+static const unsigned int* const torus_blobs[NUM_TORUS_LODS] = { torus_lod0_blob, torus_lod1_blob, torus_lod2_blob };
+#endif
+
+void mesh_init(void) {
+    mesh_load(&cube_mesh, cube_blob);
+    mesh_load(&ripple_mesh, ripple_blob);
+    anim_load(&ripple, ripple_anim);
+    for (int i = 0; i < NUM_TORUS_LODS; i++) torus_lods[i] = (Mesh){ 0 };
+    for (int s = SURFACE_TORUS + 1; s < NUM_SURFACES; s++) {
+#if BAKED_MESHES
+        mesh_load(&surface_meshes[s], surface_blobs[s]);
+#else
+        const SurfaceParams* p = &surface_params[s];
+        if (!mesh_generate(&surface_meshes[s], s, p->u, p->v, p->a, p->b)) surface_meshes[s] = (Mesh){ 0 };
+#endif
+    }
+}
+
+int load_torus(int major_segments, int minor_segments) {
+#if BAKED_MESHES
+    if (major_segments == TORUS_MAJOR_SEGMENTS && minor_segments == TORUS_MINOR_SEGMENTS) {
+        for (int lod = 0; lod < NUM_TORUS_LODS; lod++) mesh_load(&torus_lods[lod], torus_blobs[lod]);
+        return 1;
+    }
+#endif
+    return 0;
+}
+
+// --- Model Generation ---
+int mesh_generate(Mesh* mesh, enum SurfaceType type, int u, int v, int a, int b) {
+    SurfaceSize sz;
+    if (!surface_size(type, u, v, &sz)) return 0;
+    int nv = sz.num_vertices, ne = sz.num_edges, nf = sz.num_faces;
+    unsigned int mark = arena_mark(ARENA_EWRAM);
+    short* x = arena_alloc(ARENA_EWRAM, 3 * nv * sizeof(short));
+    unsigned short (*faces)[4] = nf ? arena_alloc(ARENA_EWRAM, nf * sizeof(*faces)) : 0;
+    unsigned short (*edge_faces)[2] = nf ? arena_alloc(ARENA_EWRAM, ne * sizeof(*edge_faces)) : 0;
+    if (!x || (nf && (!faces || !edge_faces))) { arena_release(ARENA_EWRAM, mark); return 0; }
+    short* y = x + nv;
+    short* z = y + nv;
+
+    // The edge list and scratch only live until the strips are built. The
+    // strips go above them at their worst-case length, then move down over
+    // them once the real length is known.
+    unsigned int scratch_mark = arena_mark(ARENA_EWRAM);
+    int capacity = STRIP_MAX_ENTRIES(nv, ne, 0xFFFF);
+    int scratch_words = STRIP_SCRATCH_WORDS(nv, ne);
+    if (scratch_words < STRIP_FACE_SCRATCH_WORDS(nv, nf)) scratch_words = STRIP_FACE_SCRATCH_WORDS(nv, nf);
+    unsigned short (*edges)[2] = arena_alloc(ARENA_EWRAM, ne * sizeof(*edges));
+    int* scratch = arena_alloc(ARENA_EWRAM, scratch_words * sizeof(int));
+    unsigned short* built = arena_alloc(ARENA_EWRAM, capacity * sizeof(unsigned short));
+    if (!edges || !scratch || !built) { arena_release(ARENA_EWRAM, mark); return 0; }
+
+    surface_build(type, u, v, a, b, x, y, z, edges, faces);
+    int entries;
+    int num_strips = strip_build((const unsigned short (*)[2])edges, ne, nv, 0xFFFF, built, capacity, &entries, scratch);
+    if (nf) strip_edge_faces(built, num_strips, (const unsigned short (*)[4])faces, nf, nv, edge_faces, scratch);
+    arena_release(ARENA_EWRAM, scratch_mark);
+    unsigned short* strips = arena_alloc(ARENA_EWRAM, entries * sizeof(unsigned short));
+    for (int i = 0; i < entries; i++) strips[i] = built[i]; // strips < built: a forward copy is safe
+
+    *mesh = (Mesh){ nv, ne, x, y, z, num_strips, strips, 0, surface_radius(x, y, z, nv), { 0, 0, 0 },
+                    nf, (const unsigned short (*)[4])faces, (const unsigned short (*)[2])edge_faces };
+    return 1;
+}
+
+int generate_torus(int major_segments, int minor_segments, int major_radius, int minor_radius) {
+    unsigned int mark = arena_mark(ARENA_EWRAM);
+    for (int lod = 0; lod < NUM_TORUS_LODS; lod++) {
+        int major = major_segments >> lod, minor = minor_segments >> lod;
+        if (major < 3) major = 3;
+        if (minor < 3) minor = 3;
+        if (!mesh_generate(&torus_lods[lod], SURFACE_TORUS, major, minor, major_radius, minor_radius)) {
+            arena_release(ARENA_EWRAM, mark);
+            for (int i = 0; i < NUM_TORUS_LODS; i++) torus_lods[i] = (Mesh){ 0 };
+            return 0;
+        }
+    }
+    return 1;
+}
@@ -0,0 +1,55 @@
+#include "platform.h"
+#include "sections.h"
+
+static EWRAM_BSS unsigned short offscreen_page[PAGE_BYTES / 2] __attribute__((aligned(4)));
+volatile unsigned short* back_buffer = offscreen_page;
+
+void plat_init(void) {
+    REG_DISPCNT = MODE4 | BG2_ENABLE;
+
+    REG_TM0CNT_H = 0; REG_TM1CNT_H = 0; REG_TM0CNT_L = 0; REG_TM1CNT_L = 0;
+    REG_TM0CNT_H = TIMER_ENABLE;
+    REG_TM1CNT_H = TIMER_ENABLE | TIMER_CASCADE;
+
+    REG_IME = 0;
+    REG_IRQ_HANDLER = plat_irq_handler;
+    REG_DISPSTAT |= DISPSTAT_VBLANK_IRQ;
+    REG_IE = IRQ_VBLANK;
+    REG_IME = 1;
+}
+
+void plat_set_palette(int index, unsigned short color) { PALETTE_MEM[index] = color; }
+int plat_page(void) { return back_buffer == VRAM_PAGE1; }
+void plat_set_target(int vram_page) { back_buffer = vram_page < 0 ? offscreen_page : plat_vram_page(vram_page); }
+void plat_fill32(volatile void* dst, unsigned int value, int words) { volatile unsigned int src = value; REG_DMA3SAD = (unsigned int)&src; REG_DMA3DAD = (unsigned int)dst; REG_DMA3CNT = words | DMA_SRC_FIXED | DMA_32 | DMA_ENABLE; }
+unsigned short plat_keys(void) { return ~REG_KEYINPUT; }
+
+// The end of IWRAM data. gba_cart.ld places .data and the IWRAM overlays
+// after .bss, so __bss_end__ would let the paint run over initialized
+// globals; __iheap_start follows the last of them, the same end
+// tools/memreport takes from the highest IWRAM section. The user stack sits
+// at the top of IWRAM, growing down towards it.
+extern char __iheap_start[];
+void* plat_stack_limit(void) { return __iheap_start; }
+
+// --- Display ---
+// The copy halts the CPU, about a quarter of a frame for all 9600 words;
+// a VBlank interrupt raised meanwhile is taken as soon as it ends.
+volatile unsigned short* plat_vram_page(int vram_page) { return vram_page ? VRAM_PAGE1 : VRAM_PAGE0; }
+void plat_copy_rows(int vram_page, int y0, int y1) {
+    int offset = y0 * (SCREEN_WIDTH / 2);
+    REG_DMA3SAD = (unsigned int)(offscreen_page + offset);
+    REG_DMA3DAD = (unsigned int)(plat_vram_page(vram_page) + offset);
+    REG_DMA3CNT = ((y1 - y0 + 1) * (SCREEN_WIDTH / 4)) | DMA_32 | DMA_ENABLE;
+}
+void plat_show_page(int vram_page) { if (vram_page) REG_DISPCNT |= DISP_BACKBUFFER; else REG_DISPCNT &= ~DISP_BACKBUFFER; }
+unsigned int plat_vcount(void) { return REG_VCOUNT; }
+void plat_irq_lock(void) { REG_IME = 0; }
+void plat_irq_unlock(void) { REG_IME = 1; }
+
+// IntrWait(0, IRQ_VBLANK): returns at once if the handler flagged a VBlank
+// since the last call, otherwise halts until it does, and clears the flag.
+// Thumb code, so the swi immediate is the BIOS call number itself.
+void plat_wait_vblank(void) {
+    asm volatile("mov r0, #0\n\tmov r1, #1\n\tswi 0x04" ::: "r0", "r1", "r2", "r3", "memory");
+}
@@ -0,0 +1,12 @@
+#include "platform.h"
+#include "present.h"
+#include "sections.h"
+
+// Called by the BIOS interrupt dispatcher in ARM state with interrupts
+// masked. Only VBlank is enabled (plat_init).
+IWRAM_CODE void plat_irq_handler(void) {
+    unsigned short flags = REG_IF;
+    if (flags & IRQ_VBLANK) present_vblank();
+    REG_IFBIOS |= flags;
+    REG_IF = flags;
+}
@@ -0,0 +1,63 @@
+#include "present.h"
+#include "framebuffer.h"
+
+enum FramePacing frame_pacing;
+PresentStats present_stats;
+
+// Shared with the VBlank interrupt.
+static volatile int shown_page;
+static volatile int queued_page = -1; // VRAM page waiting for a flip, or -1
+static volatile unsigned int last_flip; // present_stats.vblanks at the last flip
+
+void present_init(void) {
+    plat_irq_lock();
+    frame_pacing = PACE_60;
+    present_stats = (PresentStats){ 0, 0, 0, 0, 0 };
+    shown_page = 0; queued_page = -1; last_flip = 0;
+    plat_show_page(0);
+    plat_irq_unlock();
+    present_retarget();
+}
+
+void present_retarget(void) {
+    while (queued_page >= 0) plat_wait_vblank();
+    plat_set_target(fb->offscreen ? -1 : shown_page ^ 1);
+}
+
+void present_set_pacing(enum FramePacing pacing) { frame_pacing = pacing; }
+
+void present_vblank(void) {
+    unsigned int now = ++present_stats.vblanks;
+    if (queued_page < 0 || now - last_flip < (frame_pacing == PACE_30 ? 2u : 1u)) return;
+    plat_show_page(queued_page);
+    shown_page = queued_page;
+    queued_page = -1;
+    last_flip = now;
+    present_stats.shown++;
+}
+
+// Drawing straight into VRAM: the next frame's page is the one queued now
+// until the flip, so wait for it here.
+static void present_direct(void) {
+    queued_page = plat_page();
+    present_stats.presented++;
+    while (queued_page >= 0) { plat_wait_vblank(); present_stats.waits++; }
+    plat_set_target(shown_page ^ 1);
+}
+
+// The page is unqueued before the copy starts, so a VBlank during the copy
+// can never flip to a half-written page.
+void present_frame(void) {
+    if (!fb->offscreen) { present_direct(); return; }
+    if (frame_pacing != PACE_UNCAPPED) {
+        while (queued_page >= 0) { plat_wait_vblank(); present_stats.waits++; }
+    }
+    plat_irq_lock();
+    if (queued_page >= 0) present_stats.dropped++;
+    queued_page = -1;
+    int page = shown_page ^ 1;
+    plat_irq_unlock();
+    fb->present(page);
+    queued_page = page;
+    present_stats.presented++;
+}
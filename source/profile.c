@@ -0,0 +1,63 @@
+#include "profile.h"
+#include "recip.h"
+#include "sections.h"
+
+const char* const prof_zone_names[NUM_PROF_ZONES] = { "frame", "clear", "transform", "raster", "clip", "hud", "present" };
+const signed char prof_zone_parent[NUM_PROF_ZONES] = { -1, PROF_FRAME, PROF_FRAME, PROF_FRAME, PROF_RASTER, PROF_FRAME, PROF_FRAME };
+
+#if PROFILE_ENABLED
+
+// p99 by nearest rank: at most PROF_P99_MAX samples lie above it.
+#define PROF_P99_MAX (PROF_HISTORY / 100 + 2)
+
+unsigned int prof_start[NUM_PROF_ZONES];
+unsigned int prof_accum[NUM_PROF_ZONES];
+
+static EWRAM_BSS unsigned int prof_ring[PROF_HISTORY][NUM_PROF_ZONES];
+static int prof_head, prof_count;
+
+void prof_reset(void) {
+    for (int z = 0; z < NUM_PROF_ZONES; z++) prof_accum[z] = 0;
+    prof_head = 0; prof_count = 0;
+}
+
+void prof_end_frame(void) {
+    unsigned int* slot = prof_ring[prof_head];
+    for (int z = 0; z < NUM_PROF_ZONES; z++) { slot[z] = prof_accum[z]; prof_accum[z] = 0; }
+    prof_head = (prof_head + 1) & (PROF_HISTORY - 1);
+    if (prof_count < PROF_HISTORY) prof_count++;
+}
+
+int prof_frames(void) { return prof_count; }
+
+unsigned int prof_sample(int frames_ago, int zone) {
+    return prof_ring[(prof_head - 1 - frames_ago) & (PROF_HISTORY - 1)][zone];
+}
+
+// One pass over the ring: the k largest samples are kept in a short sorted
+// list, so p99 needs no sort and no scratch buffer.
+void prof_stats(int zone, ProfStats* out) {
+    int n = prof_count;
+    if (!n) { out->min = out->avg = out->max = out->p99 = 0; return; }
+    int rank = ((99 * n + 99) * 5243) >> 19; // ceil(0.99 n), 1-based: / 100 holds below 43699
+    int k = n - rank + 1;
+    unsigned int top[PROF_P99_MAX] = { 0 };
+    unsigned int lo = ~0u, sum = 0;
+    int kept = 0;
+    for (int i = 0; i < n; i++) {
+        unsigned int v = prof_ring[i][zone];
+        sum += v;
+        if (v < lo) lo = v;
+        if (kept < k || v > top[kept - 1]) {
+            int j = (kept < k) ? kept++ : kept - 1;
+            while (j > 0 && top[j - 1] < v) { top[j] = top[j - 1]; j--; }
+            top[j] = v;
+        }
+    }
+    out->min = lo;
+    out->max = top[0];
+    out->p99 = top[k - 1];
+    out->avg = recip_div(sum, n, 0);
+}
+
+#endif // PROFILE_ENABLED
@@ -0,0 +1,229 @@
+#include <stdlib.h>
+#include "render.h"
+#include "recip.h"
+
+// Line rasterizer for pre-clipped lines. Both endpoints must already be on
+// screen (liang_barsky_clip guarantees this), so the inner loops carry no
+// bounds checks. Lines are split by octant: horizontal and shallow x-major
+// lines are emitted as one span per row so neighbouring pixels go out as
+// whole halfword/word stores, while vertical, diagonal and y-major lines
+// step a row pointer with a single store per pixel. Pixel output is
+// identical to the reference Bresenham loop in both directions. The *_open
+// variants stop one pixel short of the end point so a polyline plots each
+// shared vertex once.
+//
+// Every kernel is written once and instantiated for the two pixel formats
+// of include/framebuffer.h: Mode 4 VRAM, where a lone pixel is a halfword
+// read-modify-write, and the byte-addressable offscreen page.
+
+#define KERNEL static inline __attribute__((always_inline))
+
+typedef volatile unsigned char* Row; // One row of back_buffer, by byte
+
+static inline Row row_at(int y) { return (Row)back_buffer + y * SCREEN_WIDTH; }
+
+// Single pixel. VRAM shifts the byte lane instead of branching on x & 1.
+KERNEL void plot(Row row, int x, unsigned char color, int bytes) {
+    if (bytes) { row[x] = color; return; }
+    volatile unsigned short* p = (volatile unsigned short*)row + (x >> 1);
+    int s = (x & 1) << 3;
+    *p = (*p & (0xFF00 >> s)) | (color << s);
+}
+
+// Fill pixels xa..xb (inclusive, xa <= xb) of one VRAM row. Odd ends go
+// through a read-modify-write, the inside is written as whole halfwords and words.
+static inline void span_vram(volatile unsigned short* row, int xa, int xb, unsigned int c16) {
+    if (xa & 1) { row[xa >> 1] = (row[xa >> 1] & 0x00FF) | (c16 & 0xFF00); xa++; }
+    if (!(xb & 1)) { row[xb >> 1] = (row[xb >> 1] & 0xFF00) | (c16 & 0x00FF); xb--; }
+    int h = xa >> 1, h_end = xb >> 1;
+    if (h > h_end) return;
+    if (h & 1) row[h++] = c16;
+    volatile unsigned int* w = (volatile unsigned int*)(row + h);
+    unsigned int c32 = c16 | (c16 << 16);
+    for (; h + 1 <= h_end; h += 2) *w++ = c32;
+    if (h == h_end) row[h] = c16;
+}
+
+// Byte rows: single bytes up to the first word boundary, then words.
+static inline void span_bytes(Row row, int xa, int xb, unsigned int c32) {
+    while ((xa & 3) && xa <= xb) row[xa++] = c32;
+    volatile unsigned int* w = (volatile unsigned int*)(row + xa);
+    for (; xa + 3 <= xb; xa += 4) *w++ = c32;
+    while (xa <= xb) row[xa++] = c32;
+}
+
+KERNEL void span(Row row, int xa, int xb, unsigned char color, int bytes) {
+    if (bytes) span_bytes(row, xa, xb, color * 0x01010101u);
+    else span_vram((volatile unsigned short*)row, xa, xb, color * 0x0101u);
+}
+
+KERNEL void draw_vline(int x, int y0, int y1, unsigned char color, int bytes) {
+    if (y0 > y1) { int t = y0; y0 = y1; y1 = t; }
+    if (bytes) {
+        Row p = row_at(y0) + x;
+        for (int n = y1 - y0; n >= 0; n--) { *p = color; p += SCREEN_WIDTH; }
+        return;
+    }
+    volatile unsigned short* p = (volatile unsigned short*)row_at(y0) + (x >> 1);
+    unsigned short keep = (x & 1) ? 0x00FF : 0xFF00;
+    unsigned short set = (x & 1) ? (color << 8) : color;
+    for (int n = y1 - y0; n >= 0; n--) { *p = (*p & keep) | set; p += SCREEN_WIDTH / 2; }
+}
+
+// |dx| >= |dy|: x advances every step, so pixels come in per-row runs.
+// Run-slice form of the Bresenham loop: after the first row every run is
+// q or q + 1 pixels long, decided by one error test per row instead of one
+// per pixel. G tracks 2 * err - dx less the run already emitted. The run
+// length q comes from the reciprocal table, which can be one off the floor
+// either way; the remainder check puts it back.
+KERNEL void draw_line_xmajor(int x0, int y0, int dx, int ady, int sx, int sy, unsigned char color, int open, int bytes) {
+    Row row = row_at(y0);
+    int row_step = sy * SCREEN_WIDTH;
+    int a = 2 * ady, q = recip_div(2 * dx, a, 0), r = 2 * dx - q * a;
+    if (r < 0) { q--; r += a; } else if (r >= a) { q++; r -= a; }
+    int g = dx - a, n = 1, x = x0, remaining = dx + 1 - open;
+    while (g > 0) { g -= a; n++; }
+    for (int rows = ady; ; rows--) {
+        if (rows == 0 && (n = remaining) == 0) break;
+        int x_end = x + sx * (n - 1);
+        if (sx > 0) span(row, x, x_end, color, bytes); else span(row, x_end, x, color, bytes);
+        if (rows == 0) break;
+        remaining -= n; x = x_end + sx; row += row_step;
+        g += r;
+        if (g > 0) { n = q + 1; g -= a; } else n = q;
+    }
+}
+
+// |dy| > |dx|: y advances every step, one pixel per row.
+KERNEL void draw_line_ymajor(int x0, int y0, int dx, int ady, int sx, int sy, unsigned char color, int open, int bytes) {
+    Row row = row_at(y0);
+    int row_step = sy * SCREEN_WIDTH;
+    int err = dx - ady, x = x0;
+    for (int i = open; i <= ady; i++) {
+        plot(row, x, color, bytes);
+        int e2 = 2 * err;
+        int step = e2 >= -ady;
+        err += dx - (step ? ady : 0); row += row_step;
+        x += step ? sx : 0;
+    }
+}
+
+// Diagonal-ish x-major lines: runs are mostly a single pixel, so plot
+// directly instead of paying for span bookkeeping.
+KERNEL void draw_line_xmajor_steep(int x0, int y0, int dx, int ady, int sx, int sy, unsigned char color, int open, int bytes) {
+    Row row = row_at(y0);
+    int row_step = sy * SCREEN_WIDTH;
+    int err = dx - ady, x = x0;
+    for (int i = open; i <= dx; i++) {
+        plot(row, x, color, bytes);
+        int e2 = 2 * err;
+        int step = e2 <= dx;
+        err += (step ? dx : 0) - ady; x += sx;
+        row += step ? row_step : 0;
+    }
+}
+
+KERNEL void raster_line(int x0, int y0, int x1, int y1, unsigned char color, int open, int bytes) {
+    int dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+    int ady = abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+    if (ady == 0) { x1 -= open * sx; if (sx > 0) { if (x0 <= x1) span(row_at(y0), x0, x1, color, bytes); } else if (x1 <= x0) span(row_at(y0), x1, x0, color, bytes); }
+    else if (dx == 0) draw_vline(x0, y0, y1 - open * sy, color, bytes);
+    else if (dx >= 2 * ady) draw_line_xmajor(x0, y0, dx, ady, sx, sy, color, open, bytes);
+    else if (dx >= ady) draw_line_xmajor_steep(x0, y0, dx, ady, sx, sy, color, open, bytes);
+    else draw_line_ymajor(x0, y0, dx, ady, sx, sy, color, open, bytes);
+}
+
+KERNEL void raster_line_guarded(int x0, int y0, int x1, int y1, unsigned char color, int open, int bytes) {
+    if ((unsigned int)x0 < SCREEN_WIDTH && (unsigned int)x1 < SCREEN_WIDTH && (unsigned int)y0 < SCREEN_HEIGHT && (unsigned int)y1 < SCREEN_HEIGHT) {
+        raster_line(x0, y0, x1, y1, color, open, bytes);
+        return;
+    }
+    int dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+    int ady = abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+    int err = dx - ady;
+    for (;;) {
+        int end = x0 == x1 && y0 == y1;
+        if (end && open) break;
+        if ((unsigned int)x0 < SCREEN_WIDTH && (unsigned int)y0 < SCREEN_HEIGHT) plot(row_at(y0), x0, color, bytes);
+        if (end) break;
+        int e2 = 2 * err;
+        if (e2 >= -ady) { err -= ady; x0 += sx; }
+        if (e2 <= dx) { err += dx; y0 += sy; }
+    }
+}
+
+// Convex polygon fill by edge walking. With a front face's winding (see
+// face_sides) an edge running down the screen bounds the left end of the
+// rows it crosses and an edge running up bounds the right end, so one pass
+// over the edges fills both tables with no sort. Each edge steps x in 16.16
+// from a reciprocal-table slope, and row y covers pixel centres from
+// ceil(left) to ceil(right) - 1: faces sharing an edge neither overlap nor
+// leave a gap. Back-facing input leaves every row empty.
+static int fill_left[SCREEN_HEIGHT], fill_right[SCREEN_HEIGHT];
+
+static void fill_edges(const int* xs, const int* ys, int n, int y0, int y1) {
+    for (int y = y0; y < y1; y++) { fill_left[y] = SCREEN_WIDTH; fill_right[y] = 0; }
+    for (int i = 0; i < n; i++) {
+        int j = (i + 1 == n) ? 0 : i + 1;
+        int xa = xs[i], ya = ys[i], xb = xs[j], yb = ys[j];
+        if (ya == yb) continue;
+        int* side = fill_left;
+        if (ya > yb) { int t = xa; xa = xb; xb = t; t = ya; ya = yb; yb = t; side = fill_right; }
+        int top = ya > y0 ? ya : y0, end = yb < y1 ? yb : y1;
+        if (top >= end) continue;
+        int slope = recip_div(xb - xa, yb - ya, 16);
+        int x = (xa << 16) + slope * (top - ya) + 0xFFFF;
+        for (int y = top; y < end; y++) { side[y] = x >> 16; x += slope; }
+    }
+}
+
+KERNEL void raster_fill(const int* xs, const int* ys, int n, unsigned char color, int bytes) {
+    int y0 = ys[0], y1 = ys[0];
+    for (int i = 1; i < n; i++) { if (ys[i] < y0) y0 = ys[i]; if (ys[i] > y1) y1 = ys[i]; }
+    if (y0 < SCREEN_Y_MIN) y0 = SCREEN_Y_MIN;
+    if (y1 > SCREEN_HEIGHT) y1 = SCREEN_HEIGHT;
+    if (y0 >= y1) return;
+    fill_edges(xs, ys, n, y0, y1);
+    if (bytes) fb_touch_rows(y0, y1 - 1);
+    Row row = row_at(y0);
+    for (int y = y0; y < y1; y++, row += SCREEN_WIDTH) {
+        int xa = fill_left[y], xb = fill_right[y] - 1;
+        if (xa < SCREEN_X_MIN) xa = SCREEN_X_MIN;
+        if (xb > SCREEN_X_MAX) xb = SCREEN_X_MAX;
+        if (xa <= xb) span(row, xa, xb, color, bytes);
+    }
+}
+
+// Byte-page kernels also record the rows they may touch for FB_ROWS.
+static inline void touch_line_rows(int y0, int y1) {
+    int ya = y0 < y1 ? y0 : y1, yb = y0 ^ y1 ^ ya;
+    fb_touch_rows(ya < SCREEN_Y_MIN ? SCREEN_Y_MIN : ya, yb > SCREEN_Y_MAX ? SCREEN_Y_MAX : yb);
+}
+
+#define DEFINE_RASTER(suffix, bytes) \
+void raster_hspan_##suffix(int y, int xa, int xb, unsigned char color) { \
+    if (bytes) fb_touch_rows(y, y); \
+    span(row_at(y), xa, xb, color, bytes); \
+} \
+void raster_pixel_##suffix(int x, int y, unsigned char color) { \
+    if (bytes) fb_touch_rows(y, y); \
+    plot(row_at(y), x, color, bytes); \
+} \
+void raster_segment_##suffix(int x0, int y0, int x1, int y1, unsigned char color, int open) { \
+    if (bytes) touch_line_rows(y0, y1); \
+    raster_line(x0, y0, x1, y1, color, open, bytes); \
+} \
+void raster_segment_guarded_##suffix(int x0, int y0, int x1, int y1, unsigned char color, int open) { \
+    if (bytes) touch_line_rows(y0, y1); \
+    raster_line_guarded(x0, y0, x1, y1, color, open, bytes); \
+} \
+void raster_line_##suffix(int x0, int y0, int x1, int y1, unsigned char color, int flags) { \
+    if (flags & LINE_GUARDED) raster_segment_guarded_##suffix(x0, y0, x1, y1, color, flags & LINE_OPEN); \
+    else raster_segment_##suffix(x0, y0, x1, y1, color, flags & LINE_OPEN); \
+} \
+void raster_fill_##suffix(const int* xs, const int* ys, int n, unsigned char color) { \
+    raster_fill(xs, ys, n, color, bytes); \
+}
+
+DEFINE_RASTER(vram, 0)
+DEFINE_RASTER(bytes, 1)
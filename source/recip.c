@@ -0,0 +1,135 @@
+#include "recip.h"
+
+// round(2^24 / d) for d = 1 .. RECIP_TABLE_SIZE. Entry 0 saturates; callers
+// must not ask for 1/0.
+const unsigned int recip_table[RECIP_TABLE_SIZE + 1] = {
+    0xFFFFFFFF, 0x01000000, 0x00800000, 0x00555555, 0x00400000, 0x00333333, 0x002AAAAB, 0x00249249,
+    0x00200000, 0x001C71C7, 0x0019999A, 0x001745D1, 0x00155555, 0x0013B13B, 0x00124925, 0x00111111,
+    0x00100000, 0x000F0F0F, 0x000E38E4, 0x000D7943, 0x000CCCCD, 0x000C30C3, 0x000BA2E9, 0x000B2164,
+    0x000AAAAB, 0x000A3D71, 0x0009D89E, 0x00097B42, 0x00092492, 0x0008D3DD, 0x00088889, 0x00084211,
+    0x00080000, 0x0007C1F0, 0x00078788, 0x00075075, 0x00071C72, 0x0006EB3E, 0x0006BCA2, 0x00069069,
+    0x00066666, 0x00063E70, 0x00061862, 0x0005F418, 0x0005D174, 0x0005B05B, 0x000590B2, 0x00057262,
+    0x00055555, 0x00053978, 0x00051EB8, 0x00050505, 0x0004EC4F, 0x0004D487, 0x0004BDA1, 0x0004A790,
+    0x00049249, 0x00047DC1, 0x000469EE, 0x000456C8, 0x00044444, 0x0004325C, 0x00042108, 0x00041041,
+    0x00040000, 0x0003F03F, 0x0003E0F8, 0x0003D226, 0x0003C3C4, 0x0003B5CC, 0x0003A83B, 0x00039B0B,
+    0x00038E39, 0x000381C1, 0x0003759F, 0x000369D0, 0x00035E51, 0x0003531E, 0x00034835, 0x00033D92,
+    0x00033333, 0x00032916, 0x00031F38, 0x00031597, 0x00030C31, 0x00030303, 0x0002FA0C, 0x0002F14A,
+    0x0002E8BA, 0x0002E05C, 0x0002D82E, 0x0002D02D, 0x0002C859, 0x0002C0B0, 0x0002B931, 0x0002B1DA,
+    0x0002AAAB, 0x0002A3A1, 0x00029CBC, 0x000295FB, 0x00028F5C, 0x000288DF, 0x00028283, 0x00027C46,
+    0x00027627, 0x00027027, 0x00026A44, 0x0002647C, 0x00025ED1, 0x0002593F, 0x000253C8, 0x00024E6A,
+    0x00024925, 0x000243F7, 0x00023EE1, 0x000239E1, 0x000234F7, 0x00023023, 0x00022B64, 0x000226B9,
+    0x00022222, 0x00021D9F, 0x0002192E, 0x000214D0, 0x00021084, 0x00020C4A, 0x00020821, 0x00020408,
+    0x00020000, 0x0001FC08, 0x0001F820, 0x0001F446, 0x0001F07C, 0x0001ECC0, 0x0001E913, 0x0001E574,
+    0x0001E1E2, 0x0001DE5D, 0x0001DAE6, 0x0001D77B, 0x0001D41D, 0x0001D0CB, 0x0001CD85, 0x0001CA4B,
+    0x0001C71C, 0x0001C3F9, 0x0001C0E0, 0x0001BDD3, 0x0001BAD0, 0x0001B7D7, 0x0001B4E8, 0x0001B203,
+    0x0001AF28, 0x0001AC57, 0x0001A98F, 0x0001A6D0, 0x0001A41A, 0x0001A16D, 0x00019EC9, 0x00019C2D,
+    0x0001999A, 0x0001970E, 0x0001948B, 0x00019210, 0x00018F9C, 0x00018D30, 0x00018ACC, 0x0001886E,
+    0x00018618, 0x000183C9, 0x00018182, 0x00017F40, 0x00017D06, 0x00017AD2, 0x000178A5, 0x0001767E,
+    0x0001745D, 0x00017243, 0x0001702E, 0x00016E1F, 0x00016C17, 0x00016A14, 0x00016817, 0x0001661F,
+    0x0001642D, 0x00016240, 0x00016058, 0x00015E76, 0x00015C99, 0x00015AC0, 0x000158ED, 0x0001571F,
+    0x00015555, 0x00015391, 0x000151D0, 0x00015015, 0x00014E5E, 0x00014CAC, 0x00014AFD, 0x00014954,
+    0x000147AE, 0x0001460D, 0x00014470, 0x000142D6, 0x00014141, 0x00013FB0, 0x00013E23, 0x00013C99,
+    0x00013B14, 0x00013992, 0x00013814, 0x00013699, 0x00013522, 0x000133AE, 0x0001323E, 0x000130D2,
+    0x00012F68, 0x00012E02, 0x00012CA0, 0x00012B40, 0x000129E4, 0x0001288B, 0x00012735, 0x000125E2,
+    0x00012492, 0x00012345, 0x000121FB, 0x000120B4, 0x00011F70, 0x00011E2F, 0x00011CF0, 0x00011BB5,
+    0x00011A7C, 0x00011945, 0x00011812, 0x000116E0, 0x000115B2, 0x00011486, 0x0001135D, 0x00011236,
+    0x00011111, 0x00010FEF, 0x00010ECF, 0x00010DB2, 0x00010C97, 0x00010B7E, 0x00010A68, 0x00010954,
+    0x00010842, 0x00010732, 0x00010625, 0x00010519, 0x00010410, 0x00010309, 0x00010204, 0x00010101,
+    0x00010000, 0x0000FF01, 0x0000FE04, 0x0000FD09, 0x0000FC10, 0x0000FB19, 0x0000FA23, 0x0000F930,
+    0x0000F83E, 0x0000F74E, 0x0000F660, 0x0000F574, 0x0000F48A, 0x0000F3A1, 0x0000F2BA, 0x0000F1D5,
+    0x0000F0F1, 0x0000F00F, 0x0000EF2F, 0x0000EE50, 0x0000ED73, 0x0000EC98, 0x0000EBBE, 0x0000EAE5,
+    0x0000EA0F, 0x0000E939, 0x0000E866, 0x0000E793, 0x0000E6C3, 0x0000E5F3, 0x0000E526, 0x0000E459,
+    0x0000E38E, 0x0000E2C5, 0x0000E1FC, 0x0000E136, 0x0000E070, 0x0000DFAC, 0x0000DEE9, 0x0000DE28,
+    0x0000DD68, 0x0000DCA9, 0x0000DBEB, 0x0000DB2F, 0x0000DA74, 0x0000D9BA, 0x0000D902, 0x0000D84A,
+    0x0000D794, 0x0000D6DF, 0x0000D62C, 0x0000D579, 0x0000D4C7, 0x0000D417, 0x0000D368, 0x0000D2BA,
+    0x0000D20D, 0x0000D161, 0x0000D0B7, 0x0000D00D, 0x0000CF64, 0x0000CEBD, 0x0000CE17, 0x0000CD71,
+    0x0000CCCD, 0x0000CC29, 0x0000CB87, 0x0000CAE6, 0x0000CA46, 0x0000C9A6, 0x0000C908, 0x0000C86A,
+    0x0000C7CE, 0x0000C733, 0x0000C698, 0x0000C5FE, 0x0000C566, 0x0000C4CE, 0x0000C437, 0x0000C3A1,
+    0x0000C30C, 0x0000C278, 0x0000C1E5, 0x0000C152, 0x0000C0C1, 0x0000C030, 0x0000BFA0, 0x0000BF11,
+    0x0000BE83, 0x0000BDF6, 0x0000BD69, 0x0000BCDD, 0x0000BC52, 0x0000BBC8, 0x0000BB3F, 0x0000BAB6,
+    0x0000BA2F, 0x0000B9A8, 0x0000B921, 0x0000B89C, 0x0000B817, 0x0000B793, 0x0000B710, 0x0000B68D,
+    0x0000B60B, 0x0000B58A, 0x0000B50A, 0x0000B48A, 0x0000B40B, 0x0000B38D, 0x0000B30F, 0x0000B292,
+    0x0000B216, 0x0000B19B, 0x0000B120, 0x0000B0A6, 0x0000B02C, 0x0000AFB3, 0x0000AF3B, 0x0000AEC3,
+    0x0000AE4C, 0x0000ADD6, 0x0000AD60, 0x0000ACEB, 0x0000AC77, 0x0000AC03, 0x0000AB8F, 0x0000AB1D,
+    0x0000AAAB, 0x0000AA39, 0x0000A9C8, 0x0000A958, 0x0000A8E8, 0x0000A879, 0x0000A80B, 0x0000A79C,
+    0x0000A72F, 0x0000A6C2, 0x0000A656, 0x0000A5EA, 0x0000A57F, 0x0000A514, 0x0000A4AA, 0x0000A440,
+    0x0000A3D7, 0x0000A36E, 0x0000A306, 0x0000A29F, 0x0000A238, 0x0000A1D1, 0x0000A16B, 0x0000A106,
+    0x0000A0A1, 0x0000A03C, 0x00009FD8, 0x00009F74, 0x00009F11, 0x00009EAF, 0x00009E4D, 0x00009DEB,
+    0x00009D8A, 0x00009D29, 0x00009CC9, 0x00009C69, 0x00009C0A, 0x00009BAB, 0x00009B4C, 0x00009AEE,
+    0x00009A91, 0x00009A34, 0x000099D7, 0x0000997B, 0x0000991F, 0x000098C4, 0x00009869, 0x0000980E,
+    0x000097B4, 0x0000975A, 0x00009701, 0x000096A8, 0x00009650, 0x000095F8, 0x000095A0, 0x00009549,
+    0x000094F2, 0x0000949C, 0x00009446, 0x000093F0, 0x0000939B, 0x00009346, 0x000092F1, 0x0000929D,
+    0x00009249, 0x000091F6, 0x000091A3, 0x00009150, 0x000090FE, 0x000090AC, 0x0000905A, 0x00009009,
+    0x00008FB8, 0x00008F68, 0x00008F17, 0x00008EC8, 0x00008E78, 0x00008E29, 0x00008DDA, 0x00008D8C,
+    0x00008D3E, 0x00008CF0, 0x00008CA3, 0x00008C56, 0x00008C09, 0x00008BBC, 0x00008B70, 0x00008B24,
+    0x00008AD9, 0x00008A8E, 0x00008A43, 0x000089F8, 0x000089AE, 0x00008964, 0x0000891B, 0x000088D2,
+    0x00008889, 0x00008840, 0x000087F8, 0x000087AF, 0x00008768, 0x00008720, 0x000086D9, 0x00008692,
+    0x0000864C, 0x00008605, 0x000085BF, 0x00008579, 0x00008534, 0x000084EF, 0x000084AA, 0x00008465,
+    0x00008421, 0x000083DD, 0x00008399, 0x00008356, 0x00008312, 0x000082CF, 0x0000828D, 0x0000824A,
+    0x00008208, 0x000081C6, 0x00008185, 0x00008143, 0x00008102, 0x000080C1, 0x00008081, 0x00008040,
+    0x00008000, 0x00007FC0, 0x00007F80, 0x00007F41, 0x00007F02, 0x00007EC3, 0x00007E84, 0x00007E46,
+    0x00007E08, 0x00007DCA, 0x00007D8C, 0x00007D4F, 0x00007D12, 0x00007CD5, 0x00007C98, 0x00007C5B,
+    0x00007C1F, 0x00007BE3, 0x00007BA7, 0x00007B6C, 0x00007B30, 0x00007AF5, 0x00007ABA, 0x00007A7F,
+    0x00007A45, 0x00007A0A, 0x000079D0, 0x00007997, 0x0000795D, 0x00007923, 0x000078EA, 0x000078B1,
+    0x00007878, 0x00007840, 0x00007808, 0x000077CF, 0x00007797, 0x00007760, 0x00007728, 0x000076F1,
+    0x000076BA, 0x00007683, 0x0000764C, 0x00007615, 0x000075DF, 0x000075A9, 0x00007573, 0x0000753D,
+    0x00007507, 0x000074D2, 0x0000749D, 0x00007468, 0x00007433, 0x000073FE, 0x000073CA, 0x00007395,
+    0x00007361, 0x0000732D, 0x000072FA, 0x000072C6, 0x00007293, 0x00007260, 0x0000722D, 0x000071FA,
+    0x000071C7, 0x00007195, 0x00007162, 0x00007130, 0x000070FE, 0x000070CC, 0x0000709B, 0x00007069,
+    0x00007038, 0x00007007, 0x00006FD6, 0x00006FA5, 0x00006F75, 0x00006F44, 0x00006F14, 0x00006EE4,
+    0x00006EB4, 0x00006E84, 0x00006E54, 0x00006E25, 0x00006DF6, 0x00006DC7, 0x00006D98, 0x00006D69,
+    0x00006D3A, 0x00006D0C, 0x00006CDD, 0x00006CAF, 0x00006C81, 0x00006C53, 0x00006C25, 0x00006BF8,
+    0x00006BCA, 0x00006B9D, 0x00006B70, 0x00006B43, 0x00006B16, 0x00006AE9, 0x00006ABC, 0x00006A90,
+    0x00006A64, 0x00006A38, 0x00006A0C, 0x000069E0, 0x000069B4, 0x00006988, 0x0000695D, 0x00006932,
+    0x00006907, 0x000068DC, 0x000068B1, 0x00006886, 0x0000685B, 0x00006831, 0x00006807, 0x000067DC,
+    0x000067B2, 0x00006788, 0x0000675E, 0x00006735, 0x0000670B, 0x000066E2, 0x000066B9, 0x0000668F,
+    0x00006666, 0x0000663E, 0x00006615, 0x000065EC, 0x000065C4, 0x0000659B, 0x00006573, 0x0000654B,
+    0x00006523, 0x000064FB, 0x000064D3, 0x000064AB, 0x00006484, 0x0000645D, 0x00006435, 0x0000640E,
+    0x000063E7, 0x000063C0, 0x00006399, 0x00006373, 0x0000634C, 0x00006326, 0x000062FF, 0x000062D9,
+    0x000062B3, 0x0000628D, 0x00006267, 0x00006241, 0x0000621C, 0x000061F6, 0x000061D1, 0x000061AB,
+    0x00006186, 0x00006161, 0x0000613C, 0x00006117, 0x000060F2, 0x000060CE, 0x000060A9, 0x00006085,
+    0x00006060, 0x0000603C, 0x00006018, 0x00005FF4, 0x00005FD0, 0x00005FAC, 0x00005F89, 0x00005F65,
+    0x00005F41, 0x00005F1E, 0x00005EFB, 0x00005ED8, 0x00005EB5, 0x00005E92, 0x00005E6F, 0x00005E4C,
+    0x00005E29, 0x00005E07, 0x00005DE4, 0x00005DC2, 0x00005D9F, 0x00005D7D, 0x00005D5B, 0x00005D39,
+    0x00005D17, 0x00005CF5, 0x00005CD4, 0x00005CB2, 0x00005C91, 0x00005C6F, 0x00005C4E, 0x00005C2D,
+    0x00005C0C, 0x00005BEA, 0x00005BCA, 0x00005BA9, 0x00005B88, 0x00005B67, 0x00005B47, 0x00005B26,
+    0x00005B06, 0x00005AE5, 0x00005AC5, 0x00005AA5, 0x00005A85, 0x00005A65, 0x00005A45, 0x00005A25,
+    0x00005A06, 0x000059E6, 0x000059C6, 0x000059A7, 0x00005988, 0x00005968, 0x00005949, 0x0000592A,
+    0x0000590B, 0x000058EC, 0x000058CD, 0x000058AF, 0x00005890, 0x00005871, 0x00005853, 0x00005834,
+    0x00005816, 0x000057F8, 0x000057DA, 0x000057BB, 0x0000579D, 0x0000577F, 0x00005762, 0x00005744,
+    0x00005726, 0x00005708, 0x000056EB, 0x000056CD, 0x000056B0, 0x00005693, 0x00005676, 0x00005658,
+    0x0000563B, 0x0000561E, 0x00005601, 0x000055E4, 0x000055C8, 0x000055AB, 0x0000558E, 0x00005572,
+    0x00005555, 0x00005539, 0x0000551D, 0x00005500, 0x000054E4, 0x000054C8, 0x000054AC, 0x00005490,
+    0x00005474, 0x00005458, 0x0000543D, 0x00005421, 0x00005405, 0x000053EA, 0x000053CE, 0x000053B3,
+    0x00005398, 0x0000537C, 0x00005361, 0x00005346, 0x0000532B, 0x00005310, 0x000052F5, 0x000052DA,
+    0x000052BF, 0x000052A5, 0x0000528A, 0x0000526F, 0x00005255, 0x0000523A, 0x00005220, 0x00005206,
+    0x000051EC, 0x000051D1, 0x000051B7, 0x0000519D, 0x00005183, 0x00005169, 0x0000514F, 0x00005136,
+    0x0000511C, 0x00005102, 0x000050E9, 0x000050CF, 0x000050B6, 0x0000509C, 0x00005083, 0x0000506A,
+    0x00005050, 0x00005037, 0x0000501E, 0x00005005, 0x00004FEC, 0x00004FD3, 0x00004FBA, 0x00004FA1,
+    0x00004F89, 0x00004F70, 0x00004F57, 0x00004F3F, 0x00004F26, 0x00004F0E, 0x00004EF6, 0x00004EDD,
+    0x00004EC5, 0x00004EAD, 0x00004E95, 0x00004E7C, 0x00004E64, 0x00004E4C, 0x00004E35, 0x00004E1D,
+    0x00004E05, 0x00004DED, 0x00004DD5, 0x00004DBE, 0x00004DA6, 0x00004D8F, 0x00004D77, 0x00004D60,
+    0x00004D48, 0x00004D31, 0x00004D1A, 0x00004D03, 0x00004CEC, 0x00004CD4, 0x00004CBD, 0x00004CA6,
+    0x00004C90, 0x00004C79, 0x00004C62, 0x00004C4B, 0x00004C34, 0x00004C1E, 0x00004C07, 0x00004BF1,
+    0x00004BDA, 0x00004BC4, 0x00004BAD, 0x00004B97, 0x00004B81, 0x00004B6A, 0x00004B54, 0x00004B3E,
+    0x00004B28, 0x00004B12, 0x00004AFC, 0x00004AE6, 0x00004AD0, 0x00004ABA, 0x00004AA4, 0x00004A8F,
+    0x00004A79, 0x00004A63, 0x00004A4E, 0x00004A38, 0x00004A23, 0x00004A0D, 0x000049F8, 0x000049E3,
+    0x000049CD, 0x000049B8, 0x000049A3, 0x0000498E, 0x00004979, 0x00004963, 0x0000494E, 0x00004939,
+    0x00004925, 0x00004910, 0x000048FB, 0x000048E6, 0x000048D1, 0x000048BD, 0x000048A8, 0x00004893,
+    0x0000487F, 0x0000486A, 0x00004856, 0x00004841, 0x0000482D, 0x00004819, 0x00004805, 0x000047F0,
+    0x000047DC, 0x000047C8, 0x000047B4, 0x000047A0, 0x0000478C, 0x00004778, 0x00004764, 0x00004750,
+    0x0000473C, 0x00004728, 0x00004715, 0x00004701, 0x000046ED, 0x000046DA, 0x000046C6, 0x000046B2,
+    0x0000469F, 0x0000468B, 0x00004678, 0x00004665, 0x00004651, 0x0000463E, 0x0000462B, 0x00004618,
+    0x00004604, 0x000045F1, 0x000045DE, 0x000045CB, 0x000045B8, 0x000045A5, 0x00004592, 0x0000457F,
+    0x0000456C, 0x0000455A, 0x00004547, 0x00004534, 0x00004521, 0x0000450F, 0x000044FC, 0x000044EA,
+    0x000044D7, 0x000044C5, 0x000044B2, 0x000044A0, 0x0000448D, 0x0000447B, 0x00004469, 0x00004456,
+    0x00004444, 0x00004432, 0x00004420, 0x0000440E, 0x000043FC, 0x000043EA, 0x000043D8, 0x000043C6,
+    0x000043B4, 0x000043A2, 0x00004390, 0x0000437E, 0x0000436D, 0x0000435B, 0x00004349, 0x00004337,
+    0x00004326, 0x00004314, 0x00004303, 0x000042F1, 0x000042E0, 0x000042CE, 0x000042BD, 0x000042AB,
+    0x0000429A, 0x00004289, 0x00004277, 0x00004266, 0x00004255, 0x00004244, 0x00004233, 0x00004222,
+    0x00004211, 0x000041FF, 0x000041EE, 0x000041DE, 0x000041CD, 0x000041BC, 0x000041AB, 0x0000419A,
+    0x00004189, 0x00004178, 0x00004168, 0x00004157, 0x00004146, 0x00004136, 0x00004125, 0x00004115,
+    0x00004104, 0x000040F4, 0x000040E3, 0x000040D3, 0x000040C2, 0x000040B2, 0x000040A2, 0x00004091,
+    0x00004081, 0x00004071, 0x00004061, 0x00004050, 0x00004040, 0x00004030, 0x00004020, 0x00004010,
+    0x00004000
+};
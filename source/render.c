@@ -0,0 +1,274 @@
+#include "render.h"
+#include "mesh.h"
+#include "strip.h"
+#include "clear.h"
+#include "recip.h"
+#include "profile.h"
+#include "arena.h"
+
+// --- Graphics Functions ---
+void clear_screen(unsigned char color) { fb->clear(color); }
+
+int vertex_buffer_alloc(VertexBuffer* vb, int num_vertices, int num_faces) {
+    unsigned char* p = arena_frame_alloc_any(VERTEX_BUFFER_BYTES(num_vertices, num_faces));
+    if (!p) return 0;
+    vb->screen = (Point2D*)p;
+    vb->view = (ViewPoint*)(p + sizeof(Point2D) * num_vertices);
+    vb->codes = p + (sizeof(Point2D) + sizeof(ViewPoint)) * num_vertices;
+    vb->front = vb->codes + num_vertices;
+    vb->depth = 0; vb->order = 0;
+    return 1;
+}
+
+int face_order_alloc(VertexBuffer* vb, int num_faces) {
+    unsigned char* p = arena_frame_alloc_any(FACE_ORDER_BYTES(num_faces));
+    if (!p) return 0;
+    vb->depth = (int*)p;
+    vb->order = (unsigned short*)(p + sizeof(int) * num_faces);
+    return 1;
+}
+
+// --- Clipping ---
+int guard_band = GUARD_BAND_DEFAULT;
+void render_set_guard_band(int margin) { guard_band = margin < 0 ? 0 : margin; }
+
+// Fixed-point rounding can leave a clipped endpoint one pixel outside the
+// screen; the unchecked rasterizer needs it strictly inside.
+static inline void clamp_to_screen(int* x, int* y) { if (*x < SCREEN_X_MIN) *x = SCREEN_X_MIN; else if (*x > SCREEN_X_MAX) *x = SCREEN_X_MAX; if (*y < SCREEN_Y_MIN) *y = SCREEN_Y_MIN; else if (*y > SCREEN_Y_MAX) *y = SCREEN_Y_MAX; }
+int clip_test(long p, long q, long* t0, long* t1) { long r; if (p == 0 && q < 0) return 0; if (p != 0) { r = recip_div(q, p, FIXED_SHIFT); if (p < 0) { if (r > *t1) return 0; if (r > *t0) *t0 = r; } else { if (r < *t0) return 0; if (r < *t1) *t1 = r; } } return 1; }
+int liang_barsky_clip(int* x0, int* y0, int* x1, int* y1) { long dx = *x1 - *x0, dy = *y1 - *y0; long t0 = 0, t1 = 1 << FIXED_SHIFT; if (!clip_test(-dx, *x0 - SCREEN_X_MIN, &t0, &t1)) return 0; if (!clip_test(dx, SCREEN_X_MAX - *x0, &t0, &t1)) return 0; if (!clip_test(-dy, *y0 - SCREEN_Y_MIN, &t0, &t1)) return 0; if (!clip_test(dy, SCREEN_Y_MAX - *y0, &t0, &t1)) return 0; if (t1 < (1 << FIXED_SHIFT)) { *x1 = *x0 + ((t1 * dx) >> FIXED_SHIFT); *y1 = *y0 + ((t1 * dy) >> FIXED_SHIFT); } if (t0 > 0) { *x0 = *x0 + ((t0 * dx) >> FIXED_SHIFT); *y0 = *y0 + ((t0 * dy) >> FIXED_SHIFT); } clamp_to_screen(x0, y0); clamp_to_screen(x1, y1); return 1; }
+
+// --- Pipeline Stages ---
+// Homogeneous near-plane clip: intersect the view-space edge with z = NEAR_Z
+// and project the intersection, replacing the endpoint that is behind it.
+void near_clip(const ViewPoint* in, const ViewPoint* behind, int* sx, int* sy) {
+    int t = recip_div(in->z - NEAR_Z, in->z - behind->z, FIXED_SHIFT);
+    int x = in->x + (((behind->x - in->x) * t) >> FIXED_SHIFT);
+    int y = in->y + (((behind->y - in->y) * t) >> FIXED_SHIFT);
+    int d = project_depth(x, y, NEAR_Z);
+    *sx = recip_div(x * VIEWER_DISTANCE, d, 0) + (SCREEN_WIDTH / 2);
+    *sy = recip_div(y * VIEWER_DISTANCE, d, 0) + (SCREEN_HEIGHT / 2);
+}
+
+// Inlined into every pipeline variant with flags a constant (PIPE_*), so
+// the tests a variant does not need compile away.
+#define STAGE static inline __attribute__((always_inline))
+
+// The line kernel for the variant's pixel format, called directly.
+STAGE void emit_line(int x0, int y0, int x1, int y1, unsigned char color, int open, int guarded, int flags) {
+    clear_track_line(x0, y0, x1, y1);
+    if (flags & PIPE_BYTES) {
+        if (guarded) raster_segment_guarded_bytes(x0, y0, x1, y1, color, open);
+        else raster_segment_bytes(x0, y0, x1, y1, color, open);
+    } else {
+        if (guarded) raster_segment_guarded_vram(x0, y0, x1, y1, color, open);
+        else raster_segment_vram(x0, y0, x1, y1, color, open);
+    }
+}
+
+// One edge through near clip, trivial accept/reject, guard band and
+// Liang-Barsky, with the endpoints already fetched. With open set the end
+// pixel is left to the next polyline segment; callers only set it when the
+// end vertex is on screen, so no clip can move it. Without PIPE_GUARD the
+// transform computed the outcodes with no band, so CLIP_GUARD goes with
+// any screen side and the guarded case cannot arise.
+STAGE void draw_segment(const VertexBuffer* vb, int p1_idx, int p2_idx, int x0, int y0, int outcode0, int x1, int y1, int outcode1,
+                        int open, unsigned char color, EdgeStats* stats, int flags) {
+    if ((flags & PIPE_NEAR) && ((outcode0 | outcode1) & CLIP_NEAR)) {
+        if (outcode0 & outcode1 & CLIP_NEAR) { stats->rejected++; return; }
+        int guard = (flags & PIPE_GUARD) ? guard_band : 0;
+        PROF_BEGIN(PROF_CLIP);
+        if (outcode0 & CLIP_NEAR) {
+            near_clip(&vb->view[p2_idx], &vb->view[p1_idx], &x0, &y0);
+            outcode0 = outcode_guard(x0, y0, guard);
+        } else {
+            near_clip(&vb->view[p1_idx], &vb->view[p2_idx], &x1, &y1);
+            outcode1 = outcode_guard(x1, y1, guard);
+        }
+        PROF_END(PROF_CLIP);
+    }
+    if (outcode0 & outcode1 & CLIP_SCREEN) { stats->rejected++; return; }
+    if (!((outcode0 | outcode1) & CLIP_SCREEN)) {
+        stats->accepted++;
+        emit_line(x0, y0, x1, y1, color, open, 0, flags);
+    } else if ((flags & PIPE_GUARD) && !((outcode0 | outcode1) & CLIP_GUARD)) {
+        stats->guarded++;
+        emit_line(x0, y0, x1, y1, color, open, 1, flags);
+    } else {
+        stats->clipped++;
+        PROF_BEGIN(PROF_CLIP);
+        int visible = liang_barsky_clip(&x0, &y0, &x1, &y1);
+        PROF_END(PROF_CLIP);
+        if (visible) emit_line(x0, y0, x1, y1, color, open, 0, flags);
+    }
+}
+
+#define DEFINE_DRAW_EDGES(name, flags) \
+static void name(const VertexBuffer* vb, const unsigned short (*edges)[2], int num_edges, unsigned char color, EdgeStats* stats) { \
+    const Point2D* points = vb->screen; \
+    const unsigned char* codes = vb->codes; \
+    for (int i = 0; i < num_edges; i++) { \
+        int a = edges[i][0], b = edges[i][1]; \
+        draw_segment(vb, a, b, points[a].x, points[a].y, codes[a], points[b].x, points[b].y, codes[b], 0, color, stats, flags); \
+    } \
+}
+
+// Each strip vertex is fetched once and handed from one segment to the
+// next. As polylines (PIPE_STRIPS) every segment but a strip's last leaves
+// its end pixel to the following one (closed strips end on their first
+// vertex, already drawn); otherwise each segment is drawn whole, as by
+// DEFINE_DRAW_EDGES.
+#define DEFINE_DRAW_STRIPS(name, index_type, flags) \
+static void name(const VertexBuffer* vb, const index_type* strips, int num_strips, unsigned char color, EdgeStats* stats) { \
+    const Point2D* points = vb->screen; \
+    const unsigned char* codes = vb->codes; \
+    while (num_strips--) { \
+        int n = *strips++; \
+        int first = *strips++, a = first; \
+        int x0 = points[a].x, y0 = points[a].y, outcode0 = codes[a]; \
+        while (--n) { \
+            int b = *strips++; \
+            int x1 = points[b].x, y1 = points[b].y, outcode1 = codes[b]; \
+            draw_segment(vb, a, b, x0, y0, outcode0, x1, y1, outcode1, ((flags) & PIPE_STRIPS) && (n > 1 || b == first) && !outcode1, color, stats, flags); \
+            a = b; x0 = x1; y0 = y1; outcode0 = outcode1; \
+        } \
+    } \
+}
+
+// --- Hidden-Line Removal ---
+int hidden_lines;
+void render_set_hidden_lines(int on) { hidden_lines = on; }
+
+// Faces wound counter-clockwise from outside still look counter-clockwise
+// on screen when they face the camera; with y pointing down that is a
+// negative cross product of the quad's diagonals. A face with a vertex in
+// front of the near plane has no usable projection and counts as visible.
+void face_sides(const VertexBuffer* vb, const unsigned short (*faces)[4], int num_faces) {
+    const Point2D* p = vb->screen;
+    const unsigned char* codes = vb->codes;
+    unsigned char* front = vb->front;
+    for (int f = 0; f < num_faces; f++) {
+        int a = faces[f][0], b = faces[f][1], c = faces[f][2], d = faces[f][3];
+        if ((codes[a] | codes[b] | codes[c] | codes[d]) & CLIP_NEAR) { front[f] = 1; continue; }
+        int cross = (p[c].x - p[a].x) * (p[d].y - p[b].y) - (p[c].y - p[a].y) * (p[d].x - p[b].x);
+        front[f] = cross < 0;
+    }
+}
+
+static inline int edge_visible(const unsigned char* front, const unsigned short* faces) {
+    return faces[0] == FACE_NONE || front[faces[0]] || (faces[1] != FACE_NONE && front[faces[1]]);
+}
+
+// As DEFINE_DRAW_STRIPS, but a polyline segment only leaves its end pixel
+// open when the next segment is drawn, and a closed strip only when its
+// first was.
+#define DEFINE_DRAW_STRIPS_HIDDEN(name, index_type, flags) \
+static void name(const VertexBuffer* vb, const index_type* strips, int num_strips, \
+                 const unsigned short (*edge_faces)[2], unsigned char color, EdgeStats* stats) { \
+    const Point2D* points = vb->screen; \
+    const unsigned char* codes = vb->codes; \
+    const unsigned char* front = vb->front; \
+    while (num_strips--) { \
+        int n = *strips++; \
+        int first = *strips++, a = first; \
+        int x0 = points[a].x, y0 = points[a].y, outcode0 = codes[a]; \
+        int visible = edge_visible(front, *edge_faces++), first_visible = visible; \
+        while (--n) { \
+            int b = *strips++; \
+            int next_visible = (n > 1) ? edge_visible(front, *edge_faces++) : (b == first && first_visible); \
+            int x1 = points[b].x, y1 = points[b].y, outcode1 = codes[b]; \
+            if (visible) draw_segment(vb, a, b, x0, y0, outcode0, x1, y1, outcode1, ((flags) & PIPE_STRIPS) && next_visible && !outcode1, color, stats, flags); \
+            else stats->hidden++; \
+            a = b; x0 = x1; y0 = y1; outcode0 = outcode1; visible = next_visible; \
+        } \
+    } \
+}
+
+// --- Pipeline Variants ---
+#define DEFINE_PIPELINE(suffix, flags) \
+DEFINE_DRAW_EDGES(draw_edges_##suffix, flags) \
+DEFINE_DRAW_STRIPS(draw_strips_##suffix, unsigned short, flags) \
+DEFINE_DRAW_STRIPS(draw_strips8_##suffix, unsigned char, flags) \
+DEFINE_DRAW_STRIPS_HIDDEN(draw_strips_hidden_##suffix, unsigned short, flags) \
+DEFINE_DRAW_STRIPS_HIDDEN(draw_strips8_hidden_##suffix, unsigned char, flags)
+
+DEFINE_PIPELINE(ortho_clip_vram, 0)
+DEFINE_PIPELINE(persp_clip_vram, PIPE_NEAR)
+DEFINE_PIPELINE(ortho_guard_vram, PIPE_GUARD)
+DEFINE_PIPELINE(persp_guard_vram, PIPE_NEAR | PIPE_GUARD)
+DEFINE_PIPELINE(ortho_clip_bytes, PIPE_BYTES)
+DEFINE_PIPELINE(persp_clip_bytes, PIPE_BYTES | PIPE_NEAR)
+DEFINE_PIPELINE(ortho_guard_bytes, PIPE_BYTES | PIPE_GUARD)
+DEFINE_PIPELINE(persp_guard_bytes, PIPE_BYTES | PIPE_NEAR | PIPE_GUARD)
+DEFINE_PIPELINE(ortho_clip_vram_strips, PIPE_STRIPS)
+DEFINE_PIPELINE(persp_clip_vram_strips, PIPE_STRIPS | PIPE_NEAR)
+DEFINE_PIPELINE(ortho_guard_vram_strips, PIPE_STRIPS | PIPE_GUARD)
+DEFINE_PIPELINE(persp_guard_vram_strips, PIPE_STRIPS | PIPE_NEAR | PIPE_GUARD)
+DEFINE_PIPELINE(ortho_clip_bytes_strips, PIPE_STRIPS | PIPE_BYTES)
+DEFINE_PIPELINE(persp_clip_bytes_strips, PIPE_STRIPS | PIPE_BYTES | PIPE_NEAR)
+DEFINE_PIPELINE(ortho_guard_bytes_strips, PIPE_STRIPS | PIPE_BYTES | PIPE_GUARD)
+DEFINE_PIPELINE(persp_guard_bytes_strips, PIPE_STRIPS | PIPE_BYTES | PIPE_NEAR | PIPE_GUARD)
+
+#define PIPELINE(suffix, name, flags) { name, flags, draw_edges_##suffix, draw_strips_##suffix, draw_strips8_##suffix, \
+                                        draw_strips_hidden_##suffix, draw_strips8_hidden_##suffix }
+const Pipeline pipelines[NUM_PIPELINES] = {
+    PIPELINE(ortho_clip_vram, "ortho clip vram", 0),
+    PIPELINE(persp_clip_vram, "persp clip vram", PIPE_NEAR),
+    PIPELINE(ortho_guard_vram, "ortho guard vram", PIPE_GUARD),
+    PIPELINE(persp_guard_vram, "persp guard vram", PIPE_NEAR | PIPE_GUARD),
+    PIPELINE(ortho_clip_bytes, "ortho clip bytes", PIPE_BYTES),
+    PIPELINE(persp_clip_bytes, "persp clip bytes", PIPE_BYTES | PIPE_NEAR),
+    PIPELINE(ortho_guard_bytes, "ortho guard bytes", PIPE_BYTES | PIPE_GUARD),
+    PIPELINE(persp_guard_bytes, "persp guard bytes", PIPE_BYTES | PIPE_NEAR | PIPE_GUARD),
+    PIPELINE(ortho_clip_vram_strips, "ortho clip vram strips", PIPE_STRIPS),
+    PIPELINE(persp_clip_vram_strips, "persp clip vram strips", PIPE_STRIPS | PIPE_NEAR),
+    PIPELINE(ortho_guard_vram_strips, "ortho guard vram strips", PIPE_STRIPS | PIPE_GUARD),
+    PIPELINE(persp_guard_vram_strips, "persp guard vram strips", PIPE_STRIPS | PIPE_NEAR | PIPE_GUARD),
+    PIPELINE(ortho_clip_bytes_strips, "ortho clip bytes strips", PIPE_STRIPS | PIPE_BYTES),
+    PIPELINE(persp_clip_bytes_strips, "persp clip bytes strips", PIPE_STRIPS | PIPE_BYTES | PIPE_NEAR),
+    PIPELINE(ortho_guard_bytes_strips, "ortho guard bytes strips", PIPE_STRIPS | PIPE_BYTES | PIPE_GUARD),
+    PIPELINE(persp_guard_bytes_strips, "persp guard bytes strips", PIPE_STRIPS | PIPE_BYTES | PIPE_NEAR | PIPE_GUARD),
+};
+
+const Pipeline* pipeline_select(enum CameraType camera) {
+    return &pipelines[(camera == CAMERA_PERSPECTIVE ? PIPE_NEAR : 0) | (guard_band ? PIPE_GUARD : 0) | (fb->offscreen ? PIPE_BYTES : 0) |
+                      (polylines ? PIPE_STRIPS : 0)];
+}
+
+int polylines;
+void render_set_polylines(int on) { polylines = on; }
+
+// The generic entry points: the near and guard tests handle any outcodes,
+// and strips are drawn as polylines.
+static const Pipeline* generic_pipeline(void) { return &pipelines[PIPE_NEAR | PIPE_GUARD | PIPE_STRIPS | (fb->offscreen ? PIPE_BYTES : 0)]; }
+void draw_edges(const VertexBuffer* vb, const unsigned short (*edges)[2], int num_edges, unsigned char color, EdgeStats* stats) {
+    generic_pipeline()->draw_edges(vb, edges, num_edges, color, stats);
+}
+void draw_strips(const VertexBuffer* vb, const unsigned short* strips, int num_strips, unsigned char color, EdgeStats* stats) {
+    generic_pipeline()->draw_strips(vb, strips, num_strips, color, stats);
+}
+void draw_strips8(const VertexBuffer* vb, const unsigned char* strips, int num_strips, unsigned char color, EdgeStats* stats) {
+    generic_pipeline()->draw_strips8(vb, strips, num_strips, color, stats);
+}
+void draw_strips_hidden(const VertexBuffer* vb, const unsigned short* strips, int num_strips,
+                        const unsigned short (*edge_faces)[2], unsigned char color, EdgeStats* stats) {
+    generic_pipeline()->draw_strips_hidden(vb, strips, num_strips, edge_faces, color, stats);
+}
+void draw_strips8_hidden(const VertexBuffer* vb, const unsigned char* strips, int num_strips,
+                         const unsigned short (*edge_faces)[2], unsigned char color, EdgeStats* stats) {
+    generic_pipeline()->draw_strips8_hidden(vb, strips, num_strips, edge_faces, color, stats);
+}
+
+void draw_mesh(const Mesh* mesh, const Pipeline* pipe, const VertexBuffer* vb, unsigned char color, EdgeStats* stats) {
+    if (solid_fill && mesh->faces && vb->front && vb->depth) {
+        draw_faces(vb, mesh->faces, mesh->num_faces, color, stats);
+    } else if (hidden_lines && mesh->faces && vb->front) {
+        face_sides(vb, mesh->faces, mesh->num_faces);
+        if (mesh->strips8) pipe->draw_strips8_hidden(vb, mesh->strips8, mesh->num_strips, mesh->edge_faces, color, stats);
+        else pipe->draw_strips_hidden(vb, mesh->strips, mesh->num_strips, mesh->edge_faces, color, stats);
+    } else if (mesh->strips8) {
+        pipe->draw_strips8(vb, mesh->strips8, mesh->num_strips, color, stats);
+    } else {
+        pipe->draw_strips(vb, mesh->strips, mesh->num_strips, color, stats);
+    }
+}
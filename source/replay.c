@@ -0,0 +1,30 @@
+#include "replay.h"
+
+enum ReplayMode replay_mode = REPLAY_OFF;
+
+static ReplayFrame* record_frames;
+static const ReplayFrame* play_frames;
+static int replay_count, replay_pos;
+
+void replay_record(ReplayFrame* frames, int capacity) {
+    record_frames = frames; play_frames = frames;
+    replay_count = capacity; replay_pos = 0;
+    replay_mode = REPLAY_RECORD;
+}
+
+void replay_play(const ReplayFrame* frames, int count) {
+    record_frames = 0; play_frames = frames;
+    replay_count = count; replay_pos = 0;
+    replay_mode = REPLAY_PLAY;
+}
+
+void replay_stop(void) { replay_mode = REPLAY_OFF; }
+
+int replay_position(void) { return replay_pos; }
+
+void replay_frame(ReplayFrame* frame) {
+    if (replay_mode == REPLAY_OFF) return;
+    if (replay_pos == replay_count) { replay_mode = REPLAY_OFF; return; }
+    if (replay_mode == REPLAY_RECORD) record_frames[replay_pos++] = *frame;
+    else *frame = play_frames[replay_pos++];
+}
@@ -0,0 +1,89 @@
+#include "scene.h"
+#include "clear.h"
+#include "recip.h"
+#include "profile.h"
+#include "arena.h"
+
+// Perspective side planes pass through the eye and a screen edge. Their
+// normals (VIEWER_DISTANCE, -half extent) are scaled by the normal's length
+// rounded up, so the sphere test never rejects anything that reaches the
+// screen.
+#define FRUSTUM_LEN_X 283 // sqrt(256^2 + 120^2) = 282.7
+#define FRUSTUM_LEN_Y 269 // sqrt(256^2 + 80^2) = 268.2
+
+int scene_project_radius(const Mesh* mesh, const Matrix3* m, enum CameraType camera) {
+    int mx = mesh->center[0], my = mesh->center[1], mz = mesh->center[2];
+    int cx = ((m->m[0][0] * mx + m->m[0][1] * my + m->m[0][2] * mz) >> FIXED_SHIFT) + m->t[0];
+    int cy = ((m->m[1][0] * mx + m->m[1][1] * my + m->m[1][2] * mz) >> FIXED_SHIFT) + m->t[1];
+    int cz = ((m->m[2][0] * mx + m->m[2][1] * my + m->m[2][2] * mz) >> FIXED_SHIFT) + m->t[2];
+    int r = mesh->radius;
+    if (camera == CAMERA_ORTHOGRAPHIC) {
+        if (cx - r > SCREEN_WIDTH / 2 || -cx - r > SCREEN_WIDTH / 2) return -1;
+        if (cy - r > SCREEN_HEIGHT / 2 || -cy - r > SCREEN_HEIGHT / 2) return -1;
+        return r;
+    }
+    if (cz + r < NEAR_Z) return -1;
+    int ex = cz * (SCREEN_WIDTH / 2), ey = cz * (SCREEN_HEIGHT / 2);
+    if (cx * VIEWER_DISTANCE - ex > r * FRUSTUM_LEN_X || -cx * VIEWER_DISTANCE - ex > r * FRUSTUM_LEN_X) return -1;
+    if (cy * VIEWER_DISTANCE - ey > r * FRUSTUM_LEN_Y || -cy * VIEWER_DISTANCE - ey > r * FRUSTUM_LEN_Y) return -1;
+    if (cz - r < NEAR_Z) return SCREEN_WIDTH; // Reaches the near plane: finest level
+    return recip_div(r * VIEWER_DISTANCE, cz, 0);
+}
+
+void scene_buffer_size(const Instance* instances, int num_instances, int* num_vertices, int* num_faces) {
+    *num_vertices = 0; *num_faces = 0;
+    for (int i = 0; i < num_instances; i++) {
+        const Model* model = instances[i].model;
+        for (int l = 0; l < model->num_lods; l++) {
+            if (model->lods[l]->num_vertices > *num_vertices) *num_vertices = model->lods[l]->num_vertices;
+            if (model->lods[l]->num_faces > *num_faces) *num_faces = model->lods[l]->num_faces;
+        }
+    }
+}
+
+static void draw_instance(const Instance* inst, enum CameraType camera, const Pipeline* pipe, const VertexBuffer* vb, EdgeStats* edges, SceneStats* stats) {
+    const Model* model = inst->model;
+    PROF_BEGIN(PROF_TRANSFORM);
+    Matrix3 m;
+    matrix_rotate_xy(&m, inst->angle_x, inst->angle_y);
+    m.t[0] = inst->x; m.t[1] = inst->y; m.t[2] = inst->z;
+    int radius = scene_project_radius(model->lods[0], &m, camera);
+    if (radius < 0) {
+        PROF_END(PROF_TRANSFORM);
+        stats->culled++;
+        return;
+    }
+    int lod = 0;
+    while (lod + 1 < model->num_lods && radius < model->lod_pixels[lod]) lod++;
+    const Mesh* mesh = model->lods[lod];
+    transform_mesh(mesh, &m, pipe, vb);
+    clear_mark_vertices(vb, mesh->num_vertices);
+    PROF_END(PROF_TRANSFORM);
+
+    PROF_BEGIN(PROF_RASTER);
+    draw_mesh(mesh, pipe, vb, inst->color, edges);
+    PROF_END(PROF_RASTER);
+
+    stats->drawn++;
+    stats->lod_count[lod]++;
+    stats->vertices += mesh->num_vertices;
+    stats->edges += mesh->num_edges;
+}
+
+// Solid instances are painted back to front by view depth, with the same
+// bucket sort as their faces; wireframes go in array order.
+void scene_draw(const Instance* instances, int num_instances, enum CameraType camera,
+                const VertexBuffer* vb, EdgeStats* edges, SceneStats* stats) {
+    *stats = (SceneStats){ 0, 0, { 0 }, 0, 0 };
+    const Pipeline* pipe = pipeline_select(camera);
+    unsigned char* p = solid_fill ? arena_frame_alloc_any(FACE_ORDER_BYTES(num_instances)) : 0;
+    if (p) {
+        int* depth = (int*)p;
+        unsigned short* order = (unsigned short*)(p + sizeof(int) * num_instances);
+        for (int i = 0; i < num_instances; i++) depth[i] = instances[i].z;
+        int count = depth_sort(depth, num_instances, order);
+        for (int i = 0; i < count; i++) draw_instance(&instances[order[i]], camera, pipe, vb, edges, stats);
+    } else {
+        for (int i = 0; i < num_instances; i++) draw_instance(&instances[i], camera, pipe, vb, edges, stats);
+    }
+}
@@ -0,0 +1,130 @@
+#include "render.h"
+#include "clear.h"
+#include "recip.h"
+#include "profile.h"
+
+int solid_fill;
+void render_set_solid(int on) { solid_fill = on; }
+
+void shade_ramp(unsigned char color, unsigned short rgb) {
+    int r = rgb & 31, g = (rgb >> 5) & 31, b = (rgb >> 10) & 31;
+    for (int k = 0; k < SHADE_LEVELS; k++) {
+        int s = k + 1;
+        plat_set_palette(color * SHADE_LEVELS + k, ((r * s) >> 4) | (((g * s) >> 4) << 5) | (((b * s) >> 4) << 10));
+    }
+}
+
+int depth_sort(const int* keys, int n, unsigned short* order) {
+    static int counts[DEPTH_BUCKETS];
+    int lo = 0x7FFFFFFF, hi = DEPTH_SKIP;
+    for (int i = 0; i < n; i++) {
+        if (keys[i] == DEPTH_SKIP) continue;
+        if (keys[i] < lo) lo = keys[i];
+        if (keys[i] > hi) hi = keys[i];
+    }
+    if (hi == DEPTH_SKIP) return 0;
+    int shift = 0;
+    while (((unsigned int)(hi - lo) >> shift) >= DEPTH_BUCKETS) shift++;
+    for (int b = 0; b < DEPTH_BUCKETS; b++) counts[b] = 0;
+    for (int i = 0; i < n; i++) {
+        if (keys[i] != DEPTH_SKIP) counts[(unsigned int)(hi - keys[i]) >> shift]++;
+    }
+    int total = 0;
+    for (int b = 0; b < DEPTH_BUCKETS; b++) { int c = counts[b]; counts[b] = total; total += c; }
+    for (int i = 0; i < n; i++) {
+        if (keys[i] != DEPTH_SKIP) order[counts[(unsigned int)(hi - keys[i]) >> shift]++] = i;
+    }
+    return total;
+}
+
+// --- Shading ---
+// Towards the light, up and to the left of the viewer: (-1, -1, -2) / sqrt(6)
+// in view space (y down, z into the screen), FIXED_SHIFT fraction.
+#define LIGHT_X -1672
+#define LIGHT_Y -1672
+#define LIGHT_Z -3344
+
+static unsigned int isqrt(unsigned int n) {
+    unsigned int r = 0;
+    for (unsigned int bit = 1u << 15; bit; bit >>= 1) {
+        if ((r + bit) * (r + bit) <= n) r += bit;
+    }
+    return r;
+}
+
+// Lambert term of the face's outward normal, the cross product of its
+// diagonals, scaled down first so its squared length fits 32 bits.
+static int face_level(const ViewPoint* a, const ViewPoint* b, const ViewPoint* c, const ViewPoint* d) {
+    int ux = c->x - a->x, uy = c->y - a->y, uz = c->z - a->z;
+    int vx = d->x - b->x, vy = d->y - b->y, vz = d->z - b->z;
+    int nx = uy * vz - uz * vy, ny = uz * vx - ux * vz, nz = ux * vy - uy * vx;
+    while (nx >= 16384 || nx <= -16384 || ny >= 16384 || ny <= -16384 || nz >= 16384 || nz <= -16384) { nx >>= 1; ny >>= 1; nz >>= 1; }
+    int dot = nx * LIGHT_X + ny * LIGHT_Y + nz * LIGHT_Z;
+    int len = isqrt(nx * nx + ny * ny + nz * nz);
+    if (dot <= 0 || len == 0) return SHADE_AMBIENT;
+    return SHADE_AMBIENT + ((recip_div(dot, len, 0) * (SHADE_LEVELS - 1 - SHADE_AMBIENT)) >> FIXED_SHIFT);
+}
+
+// --- Faces ---
+// Twice the signed screen area; negative for a front face (see face_sides).
+static int polygon_area(const int* xs, const int* ys, int n) {
+    int area = 0;
+    for (int i = 0, j = n - 1; i < n; j = i++) area += xs[j] * ys[i] - xs[i] * ys[j];
+    return area;
+}
+
+// Sutherland-Hodgman against the near plane: vertices in front of it keep
+// their projection and each edge crossing it adds its projected crossing.
+// A convex polygon gains at most one vertex.
+static int clip_near_polygon(const VertexBuffer* vb, const int* v, int n, int* xs, int* ys) {
+    int m = 0;
+    for (int i = 0; i < n; i++) {
+        int a = v[i], b = v[(i + 1 == n) ? 0 : i + 1];
+        int a_in = !(vb->codes[a] & CLIP_NEAR), b_in = !(vb->codes[b] & CLIP_NEAR);
+        if (a_in) { xs[m] = vb->screen[a].x; ys[m] = vb->screen[a].y; m++; }
+        if (a_in != b_in) {
+            if (a_in) near_clip(&vb->view[a], &vb->view[b], &xs[m], &ys[m]);
+            else near_clip(&vb->view[b], &vb->view[a], &xs[m], &ys[m]);
+            m++;
+        }
+    }
+    return m;
+}
+
+// Two passes: classify every face and key the survivors by the sum of their
+// view depths, then fill them farthest first. Faces crossing the near plane
+// have no usable projection for face_sides, so they are clipped first and
+// culled by the winding of what is left.
+void draw_faces(const VertexBuffer* vb, const unsigned short (*faces)[4], int num_faces, unsigned char color, EdgeStats* stats) {
+    const unsigned char* codes = vb->codes;
+    const ViewPoint* view = vb->view;
+    int* depth = vb->depth;
+    face_sides(vb, faces, num_faces);
+    for (int f = 0; f < num_faces; f++) {
+        int a = faces[f][0], b = faces[f][1], c = faces[f][2], d = faces[f][3];
+        int any = codes[a] | codes[b] | codes[c] | codes[d], all = codes[a] & codes[b] & codes[c] & codes[d];
+        depth[f] = DEPTH_SKIP;
+        if ((all & CLIP_NEAR) || (!(any & CLIP_NEAR) && (all & CLIP_SCREEN))) stats->rejected++;
+        else if (!vb->front[f]) stats->hidden++;
+        else depth[f] = view[a].z + view[b].z + view[c].z + view[d].z;
+    }
+    int count = depth_sort(depth, num_faces, vb->order);
+    int base = color * SHADE_LEVELS;
+    for (int i = 0; i < count; i++) {
+        const unsigned short* face = faces[vb->order[i]];
+        int v[4] = { face[0], face[1], face[2], face[3] };
+        int n = (v[3] == v[2]) ? 3 : 4;
+        int xs[5], ys[5];
+        if ((codes[v[0]] | codes[v[1]] | codes[v[2]] | codes[v[3]]) & CLIP_NEAR) {
+            PROF_BEGIN(PROF_CLIP);
+            n = clip_near_polygon(vb, v, n, xs, ys);
+            PROF_END(PROF_CLIP);
+            if (polygon_area(xs, ys, n) >= 0) { stats->hidden++; continue; }
+            stats->clipped++;
+        } else {
+            for (int k = 0; k < n; k++) { xs[k] = vb->screen[v[k]].x; ys[k] = vb->screen[v[k]].y; }
+            stats->accepted++;
+        }
+        fb->fill(xs, ys, n, base + face_level(&view[v[0]], &view[v[1]], &view[v[2]], &view[v[3]]));
+    }
+}
@@ -0,0 +1,25 @@
+#include "stack.h"
+#include "platform.h"
+
+static unsigned int* stack_bottom; // Lowest painted word
+static unsigned char* stack_top;   // The caller's frame at paint time
+
+// Paints through a volatile pointer: the words lie below the stack pointer
+// and nothing here reads them back.
+void stack_paint(void) {
+    unsigned int here;
+    unsigned int* p = (unsigned int*)(((unsigned long)plat_stack_limit() + 3) & ~3ul);
+    volatile unsigned int* end = (volatile unsigned int*)(((unsigned long)&here - STACK_SLACK) & ~3ul);
+    stack_bottom = p;
+    stack_top = (unsigned char*)end + STACK_SLACK;
+    for (volatile unsigned int* w = p; w < end; w++) *w = STACK_PAINT;
+}
+
+unsigned int stack_used(void) {
+    if (!stack_bottom) return 0;
+    const volatile unsigned int* w = stack_bottom;
+    while ((const unsigned char*)w < stack_top - STACK_SLACK && *w == STACK_PAINT) w++;
+    return stack_top - (const unsigned char*)w;
+}
+
+unsigned int stack_size(void) { return stack_bottom ? stack_top - (unsigned char*)stack_bottom : 0; }
@@ -0,0 +1,158 @@
+#include "strip.h"
+
+// Scratch layout, E = real edges plus virtual edges plus one:
+//   int offset[nv + 1], cursor[nv]; unsigned int used[E / 32 + 1] (bits);
+//   unsigned short adj[2E], ends[E], stack_e[E + 1], circuit_e[E + 1]
+// Edge ids are u16, so at most 65536 real and virtual edges. An edge stores
+// the xor of its two vertices: one end gives the other, so the walk keeps
+// no vertex stacks.
+
+int strip_build(const unsigned short (*edges)[2], int num_edges, int num_vertices, int max_len,
+                unsigned short* out, int capacity, int* out_entries, int* scratch) {
+    int nv = num_vertices;
+    int total = num_edges + nv / 2 + 1;
+    int* offset = scratch;
+    int* cursor = offset + nv + 1;
+    unsigned int* used = (unsigned int*)(cursor + nv);
+    unsigned short* adj = (unsigned short*)(used + total / 32 + 1);
+    unsigned short* ends = adj + 2 * total;
+    unsigned short* stack_e = ends + total;
+    unsigned short* circuit_e = stack_e + total + 1;
+
+    // Real edges, then one virtual edge per pair of odd-degree vertices.
+    int ne = 0;
+    for (int v = 0; v <= nv; v++) offset[v] = 0;
+    for (int i = 0; i < num_edges; i++) {
+        if (edges[i][0] == edges[i][1]) continue;
+        ends[ne++] = edges[i][0] ^ edges[i][1];
+        offset[edges[i][0]]++; offset[edges[i][1]]++;
+    }
+    int real = ne, odd = -1;
+    for (int v = 0; v < nv; v++) {
+        if (!(offset[v] & 1)) continue;
+        if (odd < 0) { odd = v; continue; }
+        ends[ne++] = odd ^ v;
+        offset[odd]++; offset[v]++;
+        odd = -1;
+    }
+    if (ne > 0x10000) return -1;
+
+    // Adjacency in CSR form: offset[v] .. offset[v + 1] index adj.
+    int sum = 0;
+    for (int v = 0; v < nv; v++) { int d = offset[v]; offset[v] = sum; cursor[v] = sum; sum += d; }
+    offset[nv] = sum;
+    for (int i = 0, e = 0; i < num_edges; i++) {
+        if (edges[i][0] == edges[i][1]) continue;
+        adj[cursor[edges[i][0]]++] = e;
+        adj[cursor[edges[i][1]]++] = e;
+        e++;
+    }
+    odd = -1; // Pair the odd vertices again, by their real degree
+    for (int v = 0, e = real; v < nv; v++) {
+        if (!((cursor[v] - offset[v]) & 1)) continue;
+        if (odd < 0) { odd = v; continue; }
+        adj[cursor[odd]++] = e;
+        adj[cursor[v]++] = e;
+        e++;
+        odd = -1;
+    }
+    for (int w = 0; w <= ne / 32; w++) used[w] = 0;
+    for (int v = 0; v < nv; v++) cursor[v] = offset[v];
+
+    int size = 0, strips = 0;
+    for (int s = 0; s < nv; s++) {
+        // Hierholzer over edges: circuit vertex k + 1 is the far end of
+        // circuit_e[k] from circuit vertex k, starting and ending at s.
+        int depth = 1, len = 0, v = s;
+        while (depth) {
+            while (cursor[v] < offset[v + 1] && (used[adj[cursor[v]] >> 5] >> (adj[cursor[v]] & 31) & 1)) cursor[v]++;
+            if (cursor[v] < offset[v + 1]) {
+                int e = adj[cursor[v]];
+                used[e >> 5] |= 1u << (e & 31);
+                stack_e[depth++] = e;
+                v ^= ends[e];
+            } else {
+                depth--;
+                if (depth) { circuit_e[len++] = stack_e[depth]; v ^= ends[stack_e[depth]]; }
+                else len++;
+            }
+        }
+        int m = len - 1; // Edges in the closed circuit
+        if (m <= 0) continue;
+
+        // Start just after a virtual edge so no strip wraps around the end,
+        // then cut at every virtual edge and every max_len vertices.
+        int first = 0;
+        for (int k = 0; k < m; k++) if (circuit_e[k] >= real) { first = k + 1; break; }
+        v = s;
+        for (int k = 0; k < first; k++) v ^= ends[circuit_e[k]];
+        int start = -1; // Count entry of the open strip
+        for (int j = 0; j <= m; j++) {
+            int k = (first + j) % m, virtual = j < m && circuit_e[k] >= real;
+            if (start >= 0) {
+                if (size == capacity) return -1;
+                out[size++] = v;
+                if (j == m || virtual || size - start - 1 == max_len) { out[start] = size - start - 1; start = -1; }
+            }
+            if (start < 0 && j < m && !virtual) {
+                if (size + 2 > capacity) return -1;
+                start = size;
+                out[size++] = 0;
+                out[size++] = v;
+                strips++;
+            }
+            if (j < m) v ^= ends[circuit_e[k]];
+        }
+    }
+    *out_entries = size;
+    return strips;
+}
+
+// Face edges are bucketed by their lower vertex (CSR, as above), so each
+// strip edge only scans the few face edges that share that vertex.
+int strip_edge_faces(const unsigned short* strips, int num_strips, const unsigned short (*faces)[4], int num_faces,
+                     int num_vertices, unsigned short (*edge_faces)[2], int* scratch) {
+    int nv = num_vertices;
+    int* offset = scratch;
+    int* cursor = offset + nv + 1;
+    unsigned short* other = (unsigned short*)(cursor + nv);
+    unsigned short* face = other + 4 * num_faces;
+
+    for (int v = 0; v <= nv; v++) offset[v] = 0;
+    for (int f = 0; f < num_faces; f++) {
+        for (int k = 0; k < 4; k++) {
+            int a = faces[f][k], b = faces[f][(k + 1) & 3];
+            if (a != b) offset[(a < b ? a : b) + 1]++;
+        }
+    }
+    for (int v = 0; v < nv; v++) { offset[v + 1] += offset[v]; cursor[v] = offset[v]; }
+    for (int f = 0; f < num_faces; f++) {
+        for (int k = 0; k < 4; k++) {
+            int a = faces[f][k], b = faces[f][(k + 1) & 3];
+            if (a == b) continue;
+            int lo = a < b ? a : b;
+            other[cursor[lo]] = a ^ b ^ lo;
+            face[cursor[lo]++] = f;
+        }
+    }
+
+    int k = 0;
+    while (num_strips--) {
+        int n = *strips++;
+        int a = *strips++;
+        while (--n) {
+            int b = *strips++;
+            int lo = a < b ? a : b, hi = a ^ b ^ lo, found = 0;
+            edge_faces[k][0] = edge_faces[k][1] = FACE_NONE;
+            for (int i = offset[lo]; i < offset[lo + 1]; i++) {
+                if (other[i] != hi) continue;
+                if (found < 2) edge_faces[k][found] = face[i];
+                found++;
+            }
+            if (found > 2) edge_faces[k][0] = edge_faces[k][1] = FACE_NONE;
+            k++;
+            a = b;
+        }
+    }
+    return k;
+}
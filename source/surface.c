@@ -0,0 +1,190 @@
+#include "surface.h"
+#include "render.h"
+#include "strip.h"
+#include "trig.h"
+
+const char* const surface_names[NUM_SURFACES] = { "torus", "sphere", "cylinder", "grid", "mobius" };
+
+int surface_size(enum SurfaceType type, int u, int v, SurfaceSize* size) {
+    int min_u = (type == SURFACE_GRID) ? 1 : 3;
+    int min_v = (type == SURFACE_TORUS) ? 3 : (type == SURFACE_SPHERE) ? 2 : 1;
+    if (u < min_u || v < min_v || v > 0xFFFF / u) return 0;
+    int nv, ne, nf;
+    switch (type) {
+    case SURFACE_TORUS:    nv = u * v;           ne = 2 * u * v;             nf = u * v;         break;
+    case SURFACE_SPHERE:   nv = u * (v - 1) + 2; ne = u * (2 * v - 1);       nf = u * v;         break;
+    case SURFACE_CYLINDER: nv = u * (v + 1) + 2; ne = u * (2 * v + 3);       nf = u * (v + 2);   break;
+    case SURFACE_GRID:     nv = (u + 1) * (v + 1); ne = u * (v + 1) + v * (u + 1); nf = 0;       break;
+    case SURFACE_MOBIUS:   nv = u * (v + 1);     ne = u * (2 * v + 1);       nf = 0;             break;
+    default: return 0;
+    }
+    if (nv >= FACE_NONE || ne >= FACE_NONE || nf >= FACE_NONE) return 0;
+    *size = (SurfaceSize){ nv, ne, nf };
+    return 1;
+}
+
+static void put_edge(unsigned short (*edges)[2], int* n, int a, int b) {
+    edges[*n][0] = a; edges[*n][1] = b; (*n)++;
+}
+
+static void put_face(unsigned short (*faces)[4], int* n, int a, int b, int c, int d) {
+    if (faces) { faces[*n][0] = a; faces[*n][1] = b; faces[*n][2] = c; faces[*n][3] = d; }
+    (*n)++;
+}
+
+// Minor ring j of major step i is vertex i * v + j. The tube radius of
+// step i is b + c sin(waves * angle + phase): constant for the plain torus.
+void surface_ripple(int u, int v, int a, int b, int c, int waves, unsigned int phase, short* x, short* y, short* z) {
+    int n = 0;
+    for (int i = 0; i < u; i++) {
+        SinCos su = trig_sincos((i * TRIG_ANGLES) / u);
+        int tube = b + ((c * trig_sincos(waves * ((i * TRIG_ANGLES) / u) + phase).sin) >> FIXED_SHIFT);
+        for (int j = 0; j < v; j++) {
+            SinCos sv = trig_sincos((j * TRIG_ANGLES) / v);
+            int ring = a + ((tube * sv.cos) >> FIXED_SHIFT);
+            x[n] = (ring * su.cos) >> FIXED_SHIFT;
+            y[n] = (ring * su.sin) >> FIXED_SHIFT;
+            z[n] = (tube * sv.sin) >> FIXED_SHIFT;
+            n++;
+        }
+    }
+}
+
+static void build_torus(int u, int v, int a, int b, short* x, short* y, short* z,
+                        unsigned short (*edges)[2], unsigned short (*faces)[4]) {
+    int ne = 0, nf = 0;
+    surface_ripple(u, v, a, b, 0, 0, 0, x, y, z);
+    for (int i = 0; i < u; i++) {
+        for (int j = 0; j < v; j++) {
+            int current = i * v + j, next_major = ((i + 1) % u) * v + j, next_minor = i * v + (j + 1) % v;
+            put_edge(edges, &ne, current, next_major);
+            put_edge(edges, &ne, current, next_minor);
+            // Along u then v: counter-clockwise seen from outside the tube.
+            put_face(faces, &nf, current, next_major, ((i + 1) % u) * v + (j + 1) % v, next_minor);
+        }
+    }
+}
+
+// Vertex 0 is the north pole (+z), then v - 1 rings of u from north to
+// south, then the south pole.
+static int sphere_index(int u, int v, int i, int k) {
+    return (k == 0) ? 0 : (k == v) ? u * (v - 1) + 1 : 1 + (k - 1) * u + i % u;
+}
+
+static void build_sphere(int u, int v, int a, short* x, short* y, short* z,
+                         unsigned short (*edges)[2], unsigned short (*faces)[4]) {
+    int ne = 0, nf = 0;
+    x[0] = 0; y[0] = 0; z[0] = a;
+    for (int k = 1; k < v; k++) {
+        SinCos st = trig_sincos((k * TRIG_ANGLES / 2) / v);
+        int ring = (a * st.sin) >> FIXED_SHIFT;
+        for (int i = 0; i < u; i++) {
+            SinCos sp = trig_sincos((i * TRIG_ANGLES) / u);
+            int n = sphere_index(u, v, i, k);
+            x[n] = (ring * sp.cos) >> FIXED_SHIFT;
+            y[n] = (ring * sp.sin) >> FIXED_SHIFT;
+            z[n] = (a * st.cos) >> FIXED_SHIFT;
+        }
+    }
+    int south = sphere_index(u, v, 0, v);
+    x[south] = 0; y[south] = 0; z[south] = -a;
+    for (int i = 0; i < u; i++) {
+        for (int k = 0; k < v; k++) {
+            int p = sphere_index(u, v, i, k), q = sphere_index(u, v, i, k + 1);
+            int r = sphere_index(u, v, i + 1, k + 1), s = sphere_index(u, v, i + 1, k);
+            put_edge(edges, &ne, p, q);
+            if (k > 0) put_edge(edges, &ne, p, s);
+            // South then east: counter-clockwise seen from outside.
+            if (k == 0) put_face(faces, &nf, q, r, p, p);
+            else if (k == v - 1) put_face(faces, &nf, s, p, q, q);
+            else put_face(faces, &nf, p, q, r, s);
+        }
+    }
+}
+
+// Rings of u from the top (z = b) down, then the top and bottom cap centres.
+static void build_cylinder(int u, int v, int a, int b, short* x, short* y, short* z,
+                           unsigned short (*edges)[2], unsigned short (*faces)[4]) {
+    int ne = 0, nf = 0, top = u * (v + 1), bottom = top + 1;
+    for (int i = 0; i < u; i++) {
+        SinCos sp = trig_sincos((i * TRIG_ANGLES) / u);
+        for (int k = 0; k <= v; k++) {
+            int n = k * u + i;
+            x[n] = (a * sp.cos) >> FIXED_SHIFT;
+            y[n] = (a * sp.sin) >> FIXED_SHIFT;
+            z[n] = b - (2 * b * k) / v;
+        }
+    }
+    x[top] = 0; y[top] = 0; z[top] = b;
+    x[bottom] = 0; y[bottom] = 0; z[bottom] = -b;
+    for (int i = 0; i < u; i++) {
+        int next = (i + 1) % u;
+        for (int k = 0; k <= v; k++) {
+            put_edge(edges, &ne, k * u + i, k * u + next);
+            if (k < v) {
+                put_edge(edges, &ne, k * u + i, (k + 1) * u + i);
+                put_face(faces, &nf, k * u + i, (k + 1) * u + i, (k + 1) * u + next, k * u + next);
+            }
+        }
+        put_edge(edges, &ne, top, i);
+        put_edge(edges, &ne, bottom, v * u + i);
+        put_face(faces, &nf, i, next, top, top);
+        put_face(faces, &nf, v * u + next, v * u + i, bottom, bottom);
+    }
+}
+
+static void build_grid(int u, int v, int a, int b, short* x, short* y, short* z, unsigned short (*edges)[2]) {
+    int ne = 0;
+    for (int j = 0; j <= v; j++) {
+        for (int i = 0; i <= u; i++) {
+            int n = j * (u + 1) + i;
+            x[n] = -a + (2 * a * i) / u;
+            y[n] = -b + (2 * b * j) / v;
+            z[n] = 0;
+            if (i < u) put_edge(edges, &ne, n, n + 1);
+            if (j < v) put_edge(edges, &ne, n, n + u + 1);
+        }
+    }
+}
+
+// Across the band at each of u steps around. The band turns half a turn on
+// the way round, so the last step joins across index j to v - j of the first.
+static void build_mobius(int u, int v, int a, int b, short* x, short* y, short* z, unsigned short (*edges)[2]) {
+    int ne = 0;
+    for (int i = 0; i < u; i++) {
+        SinCos around = trig_sincos((i * TRIG_ANGLES) / u), twist = trig_sincos((i * TRIG_ANGLES / 2) / u);
+        for (int j = 0; j <= v; j++) {
+            int n = i * (v + 1) + j, s = -b + (2 * b * j) / v;
+            int ring = a + ((s * twist.cos) >> FIXED_SHIFT);
+            x[n] = (ring * around.cos) >> FIXED_SHIFT;
+            y[n] = (ring * around.sin) >> FIXED_SHIFT;
+            z[n] = (s * twist.sin) >> FIXED_SHIFT;
+            if (j < v) put_edge(edges, &ne, n, n + 1);
+            put_edge(edges, &ne, n, (i + 1 < u) ? n + v + 1 : v - j);
+        }
+    }
+}
+
+void surface_build(enum SurfaceType type, int u, int v, int a, int b, short* x, short* y, short* z,
+                   unsigned short (*edges)[2], unsigned short (*faces)[4]) {
+    switch (type) {
+    case SURFACE_TORUS:    build_torus(u, v, a, b, x, y, z, edges, faces); break;
+    case SURFACE_SPHERE:   build_sphere(u, v, a, x, y, z, edges, faces); break;
+    case SURFACE_CYLINDER: build_cylinder(u, v, a, b, x, y, z, edges, faces); break;
+    case SURFACE_GRID:     build_grid(u, v, a, b, x, y, z, edges); break;
+    case SURFACE_MOBIUS:   build_mobius(u, v, a, b, x, y, z, edges); break;
+    default: break;
+    }
+}
+
+int surface_radius(const short* x, const short* y, const short* z, int num_vertices) {
+    unsigned int d2 = 0, r = 0;
+    for (int i = 0; i < num_vertices; i++) {
+        unsigned int d = (unsigned int)(x[i] * x[i]) + (unsigned int)(y[i] * y[i]) + (unsigned int)(z[i] * z[i]);
+        if (d > d2) d2 = d;
+    }
+    for (unsigned int bit = 1u << 15; bit; bit >>= 1) {
+        if ((r + bit) * (r + bit) <= d2) r += bit;
+    }
+    return (r * r < d2) ? r + 1 : r;
+}
@@ -0,0 +1,107 @@
+#include "transform.h"
+#include "sections.h"
+#include "recip.h"
+#include "trig.h"
+
+// Built with -marm and linked into IWRAM (see the *.iwram.c rule in the
+// Makefile): 32-bit fetches with no wait states for the hottest loop.
+
+void matrix_rotate_xy(Matrix3* m, unsigned int angle_x, unsigned int angle_y) {
+    SinCos ax = trig_sincos(angle_x), ay = trig_sincos(angle_y);
+    int sx = ax.sin, cx = ax.cos, sy = ay.sin, cy = ay.cos;
+    // R = Rx * Ry, so x' = cy*x - sy*z, y' = cx*y - sx*(sy*x + cy*z), z' = sx*y + cx*(sy*x + cy*z)
+    m->m[0][0] = cy;                        m->m[0][1] = 0;  m->m[0][2] = -sy;
+    m->m[1][0] = -(sx * sy) >> FIXED_SHIFT; m->m[1][1] = cx; m->m[1][2] = -(sx * cy) >> FIXED_SHIFT;
+    m->m[2][0] = (cx * sy) >> FIXED_SHIFT;  m->m[2][1] = sx; m->m[2][2] = (cx * cy) >> FIXED_SHIFT;
+    m->t[0] = 0; m->t[1] = 0; m->t[2] = Z_OFFSET;
+    m->shift = 0;
+}
+
+void matrix_scale(Matrix3* m, int scale) {
+    for (int r = 0; r < 3; r++) {
+        for (int c = 0; c < 3; c++) m->m[r][c] = (m->m[r][c] * scale) >> FIXED_SHIFT;
+    }
+}
+
+// One kernel per camera and guard band setting (the PIPE_NEAR and
+// PIPE_GUARD bits of a pipeline variant, include/render.h); the tests on
+// them fold away. Without PIPE_GUARD the outcodes are computed with no band.
+// Each comes twice: over plain x/y/z streams, and over an animation frame,
+// adding the deltas to the keyframe as the vertices are loaded. The whole
+// mesh goes through one call, with no staging copies.
+#define TRANSFORM_SETUP(flags) \
+    int m00 = m->m[0][0], m01 = m->m[0][1], m02 = m->m[0][2]; \
+    int m10 = m->m[1][0], m11 = m->m[1][1], m12 = m->m[1][2]; \
+    int m20 = m->m[2][0], m21 = m->m[2][1], m22 = m->m[2][2]; \
+    int tx = m->t[0], ty = m->t[1], tz = m->t[2]; \
+    int fraction = FIXED_SHIFT + m->shift; \
+    int guard = ((flags) & PIPE_GUARD) ? guard_band : 0; \
+    Point2D* screen = out->screen; \
+    unsigned char* codes = out->codes; \
+    ViewPoint* view = out->view
+
+#define TRANSFORM_VERTEX(flags) do { \
+    int rx = ((m00 * vx + m01 * vy + m02 * vz) >> fraction) + tx; \
+    int ry = ((m10 * vx + m11 * vy + m12 * vz) >> fraction) + ty; \
+    int rz = ((m20 * vx + m21 * vy + m22 * vz) >> fraction) + tz; \
+    view->x = rx; view->y = ry; view->z = rz; \
+    if (!((flags) & PIPE_NEAR)) { \
+        int sx = rx + (SCREEN_WIDTH / 2), sy = ry + (SCREEN_HEIGHT / 2); \
+        screen->x = sx; screen->y = sy; \
+        *codes = outcode_guard(sx, sy, guard); \
+    } else if (rz >= NEAR_Z) { \
+        int d = project_depth(rx, ry, rz); \
+        int sx = recip_div(rx * VIEWER_DISTANCE, d, 0) + (SCREEN_WIDTH / 2); \
+        int sy = recip_div(ry * VIEWER_DISTANCE, d, 0) + (SCREEN_HEIGHT / 2); \
+        screen->x = sx; screen->y = sy; \
+        *codes = outcode_guard(sx, sy, guard); \
+    } else { \
+        *codes = CLIP_NEAR; \
+    } \
+    screen++; codes++; view++; \
+} while (0)
+
+#define DEFINE_TRANSFORM(name, pose_name, flags) \
+IWRAM_CODE void name(const short* x, const short* y, const short* z, int count, const Matrix3* m, const VertexBuffer* out) { \
+    TRANSFORM_SETUP(flags); \
+    while (count--) { \
+        int vx = *x++, vy = *y++, vz = *z++; \
+        TRANSFORM_VERTEX(flags); \
+    } \
+} \
+IWRAM_CODE void pose_name(const AnimPose* pose, int count, const Matrix3* m, const VertexBuffer* out) { \
+    TRANSFORM_SETUP(flags); \
+    const short *x = pose->x, *y = pose->y, *z = pose->z; \
+    const signed char *dx = pose->dx, *dy = pose->dy, *dz = pose->dz; \
+    int shift = pose->shift; \
+    while (count--) { \
+        int vx = *x++ + (*dx++ << shift), vy = *y++ + (*dy++ << shift), vz = *z++ + (*dz++ << shift); \
+        TRANSFORM_VERTEX(flags); \
+    } \
+}
+
+DEFINE_TRANSFORM(transform_batch_orthographic_clip, transform_delta_orthographic_clip, 0)
+DEFINE_TRANSFORM(transform_batch_perspective_clip, transform_delta_perspective_clip, PIPE_NEAR)
+DEFINE_TRANSFORM(transform_batch_orthographic, transform_delta_orthographic, PIPE_GUARD)
+DEFINE_TRANSFORM(transform_batch_perspective, transform_delta_perspective, PIPE_NEAR | PIPE_GUARD)
+
+const TransformKernel transform_kernels[NUM_TRANSFORM_KERNELS] = {
+    transform_batch_orthographic_clip, transform_batch_perspective_clip, transform_batch_orthographic, transform_batch_perspective,
+};
+const DeltaKernel delta_kernels[NUM_TRANSFORM_KERNELS] = {
+    transform_delta_orthographic_clip, transform_delta_perspective_clip, transform_delta_orthographic, transform_delta_perspective,
+};
+
+void transform_mesh(const Mesh* mesh, const Matrix3* m, const Pipeline* pipe, const VertexBuffer* out) {
+    Matrix3 folded;
+    if (mesh->shift) { folded = *m; folded.shift += mesh->shift; m = &folded; }
+    transform_kernels[pipe->flags & (PIPE_NEAR | PIPE_GUARD)](mesh->x, mesh->y, mesh->z, mesh->num_vertices, m, out);
+}
+
+// Keyframes go straight from ROM through the plain kernel; delta frames are
+// decoded by the delta kernel as it loads them.
+void transform_pose(const AnimPose* pose, int num_vertices, const Matrix3* m, const Pipeline* pipe, const VertexBuffer* out) {
+    int k = pipe->flags & (PIPE_NEAR | PIPE_GUARD);
+    if (pose->dx) delta_kernels[k](pose, num_vertices, m, out);
+    else transform_kernels[k](pose->x, pose->y, pose->z, num_vertices, m, out);
+}
@@ -0,0 +1,130 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "surface.h"
+#include "animblob.h"
+#include "meshpack.h"
+#include "trig.h"
+
+// Build-time vertex animation baker (see include/animblob.h).
+//
+//   animgen [-n name] u v a b c waves frames key_interval output
+//
+// Bakes one loop of the rippling torus (surface_ripple) in `frames` poses,
+// the phase turning once over the loop. Output is C source holding two
+// word arrays: <name>_blob, the torus mesh blob (tools/meshpack.c) in its
+// first pose with a bounding radius covering every pose, and <name>_anim,
+// the animation blob.
+//
+// Every key_interval-th frame is a keyframe. The others store s8 deltas
+// from their keyframe, shifted down as far as needed to fit; a frame whose
+// deltas would need a shift above MAX_SHIFT becomes a keyframe itself.
+
+#define MAX_SHIFT 2
+
+static void put16(unsigned char* p, unsigned int v) { p[0] = v; p[1] = v >> 8; }
+static void put32(unsigned char* p, unsigned int v) { p[0] = v; p[1] = v >> 8; p[2] = v >> 16; p[3] = v >> 24; }
+static int align4(int n) { return (n + 3) & ~3; }
+
+// Shift that fits every delta of pose p from key into s8 after rounding.
+static int delta_shift(short* const p[3], short* const key[3], int n) {
+    int shift = 0;
+    for (int k = 0; k < 3; k++) {
+        for (int i = 0; i < n; i++) {
+            int d = p[k][i] - key[k][i];
+            while (((d + ((1 << shift) >> 1)) >> shift) > 127 || ((d + ((1 << shift) >> 1)) >> shift) < -128) shift++;
+        }
+    }
+    return shift;
+}
+
+int main(int argc, char** argv) {
+    const char* name = "anim";
+    int argi = 1;
+    if (argc > 2 && !strcmp(argv[1], "-n")) { name = argv[2]; argi = 3; }
+    if (argc - argi != 9) {
+        fprintf(stderr, "usage: animgen [-n name] u v a b c waves frames key_interval output\n");
+        return 1;
+    }
+    int u = atoi(argv[argi]), v = atoi(argv[argi + 1]), a = atoi(argv[argi + 2]), b = atoi(argv[argi + 3]);
+    int c = atoi(argv[argi + 4]), waves = atoi(argv[argi + 5]), frames = atoi(argv[argi + 6]), key_interval = atoi(argv[argi + 7]);
+    const char* out_path = argv[argi + 8];
+    char source[128];
+    snprintf(source, sizeof(source), "ripple %d %d %d %d %d %d, %d frames", u, v, a, b, c, waves, frames);
+
+    SurfaceSize sz;
+    if (!surface_size(SURFACE_TORUS, u, v, &sz)) { fprintf(stderr, "animgen: %s: segment counts out of range\n", source); return 1; }
+    if (a < 0 || b < c || c < 0 || a + b + c > 16383) { fprintf(stderr, "animgen: %s: radii out of range\n", source); return 1; }
+    if (frames < 1 || frames > 65535 || key_interval < 1) { fprintf(stderr, "animgen: %s: bad frame counts\n", source); return 1; }
+    int n = sz.num_vertices;
+
+    // Every pose, then the topology from the plain torus.
+    short* poses = malloc((size_t)frames * 3 * n * sizeof(short));
+    int radius = 0;
+    for (int f = 0; f < frames; f++) {
+        short* p = poses + (size_t)f * 3 * n;
+        surface_ripple(u, v, a, b, c, waves, (unsigned int)(f * TRIG_ANGLES / frames), p, p + n, p + 2 * n);
+        int r = surface_radius(p, p + n, p + 2 * n, n);
+        if (r > radius) radius = r;
+    }
+    short* v3[3];
+    for (int k = 0; k < 3; k++) v3[k] = malloc(n * sizeof(short));
+    unsigned short (*edges)[2] = malloc(sz.num_edges * sizeof(*edges));
+    unsigned short (*faces)[4] = malloc(sz.num_faces * sizeof(*faces));
+    surface_build(SURFACE_TORUS, u, v, a, b, v3[0], v3[1], v3[2], edges, faces);
+    for (int k = 0; k < 3; k++) memcpy(v3[k], poses + k * n, n * sizeof(short));
+    PackMesh mesh = { n, { v3[0], v3[1], v3[2] }, sz.num_edges, (const unsigned short (*)[2])edges,
+                      sz.num_faces, (const unsigned short (*)[4])faces, radius, { 0, 0, 0 }, 1.0 };
+    PackInfo info;
+    unsigned char* mesh_blob = meshpack_blob(&mesh, source, &info);
+    if (!mesh_blob) return 1;
+
+    // Pick keyframes and shifts, then lay the records out.
+    int* keys = malloc(frames * sizeof(int));
+    int* shifts = malloc(frames * sizeof(int));
+    int* offsets = malloc(frames * sizeof(int));
+    int key_size = 4 + 3 * align4(n * 2), delta_size = 4 + 3 * align4(n);
+    int size = ANIM_BLOB_HEADER_SIZE + frames * 4, num_keys = 0, max_error = 0;
+    for (int f = 0, key = 0; f < frames; f++) {
+        short* p[3] = { poses + (size_t)f * 3 * n, poses + (size_t)f * 3 * n + n, poses + (size_t)f * 3 * n + 2 * n };
+        short* kp[3] = { poses + (size_t)key * 3 * n, poses + (size_t)key * 3 * n + n, poses + (size_t)key * 3 * n + 2 * n };
+        int shift = (f % key_interval) ? delta_shift(p, kp, n) : MAX_SHIFT + 1;
+        if (shift > MAX_SHIFT) { key = f; shift = 0; num_keys++; }
+        keys[f] = key; shifts[f] = shift; offsets[f] = size;
+        size += (key == f) ? key_size : delta_size;
+        if (shift > 0 && (1 << (shift - 1)) > max_error) max_error = 1 << (shift - 1);
+    }
+
+    unsigned char* blob = calloc(size, 1);
+    put32(blob + 0, ANIM_BLOB_MAGIC);
+    put32(blob + 4, size);
+    put16(blob + 8, n); put16(blob + 10, frames);
+    put32(blob + 12, ANIM_BLOB_HEADER_SIZE);
+    for (int f = 0; f < frames; f++) {
+        unsigned char* r = blob + offsets[f];
+        const short* p = poses + (size_t)f * 3 * n;
+        const short* kp = poses + (size_t)keys[f] * 3 * n;
+        put32(blob + ANIM_BLOB_HEADER_SIZE + f * 4, offsets[f]);
+        put16(r, keys[f]); r[2] = shifts[f];
+        for (int k = 0; k < 3; k++) {
+            for (int i = 0; i < n; i++) {
+                if (keys[f] == f) put16(r + 4 + k * align4(n * 2) + i * 2, p[k * n + i]);
+                else r[4 + k * align4(n) + i] = (unsigned char)((p[k * n + i] - kp[k * n + i] + ((1 << shifts[f]) >> 1)) >> shifts[f]);
+            }
+        }
+    }
+
+    FILE* out = fopen(out_path, "w");
+    if (!out) { perror(out_path); return 1; }
+    char mesh_name[64], anim_name[64];
+    snprintf(mesh_name, sizeof(mesh_name), "%s_blob", name);
+    snprintf(anim_name, sizeof(anim_name), "%s_anim", name);
+    fprintf(out, "// Generated by tools/animgen from %s: %d vertices, %d edges in %d strips, %d faces;\n", source, n, sz.num_edges, info.num_strips, sz.num_faces);
+    fprintf(out, "// %d keyframes, %d bytes of animation for %d bytes of poses.\n", num_keys, size, frames * 3 * n * 2);
+    meshpack_emit(out, mesh_name, mesh_blob, info.size);
+    meshpack_emit(out, anim_name, blob, size);
+    fclose(out);
+    fprintf(stderr, "%s: %d vertices, radius %d, %d keyframes, %d bytes (%d uncompressed), max error %d\n",
+            source, n, radius, num_keys, size, frames * 3 * n * 2, max_error);
+    return 0;
+}
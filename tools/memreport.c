@@ -0,0 +1,301 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Build-time memory report for the linked image.
+//
+//   memreport [-b budget=bytes]... elf [-s subsystem] object...
+//
+// Sums the allocated sections of the (32-bit, little-endian) ELF by region
+// of the GBA memory map: ROM at 0x08000000, IWRAM at 0x03000000 and EWRAM
+// at 0x02000000. Sections with contents that run from RAM (.data, .iwram)
+// are copied out of ROM at boot, so their bytes count in ROM as well.
+//
+// Every sized function and object is then charged to the subsystem that
+// defines it: the stem of its object file (build/raster.o and
+// build/transform.iwram.o are raster and transform), or the name given by
+// the last -s before the object. Globals are matched by name, locals by
+// the FILE symbol the linker puts ahead of each object's locals. Symbols
+// from no object listed (crt0, newlib, libgcc) are "runtime"; section bytes
+// no symbol covers (alignment, literal pools) are "other".
+//
+// A budget names a region (rom, iwram, ewram) or a subsystem's share of one
+// (trig.rom). After the report, every budget exceeded is named on stderr
+// and the exit status is 1.
+
+enum Region { REGION_ROM, REGION_IWRAM, REGION_EWRAM, NUM_REGIONS };
+static const char* const region_names[NUM_REGIONS] = { "rom", "iwram", "ewram" };
+static const unsigned int region_sizes[NUM_REGIONS] = { 32 << 20, 32 << 10, 256 << 10 };
+
+// Top of the user stack in gba_cart.ld: IWRAM less the IRQ and supervisor
+// stacks and the BIOS area.
+#define USER_STACK_TOP 0x03007F00u
+
+#define SHT_PROGBITS 1
+#define SHT_SYMTAB 2
+#define SHF_ALLOC 2
+#define STT_OBJECT 1
+#define STT_FUNC 2
+#define STT_FILE 4
+#define SHN_LORESERVE 0xFF00
+
+#define MAX_SUBSYSTEMS 64
+#define MAX_BUDGETS 32
+
+typedef struct { const char* name; unsigned int bytes[NUM_REGIONS]; int objects; } Subsystem;
+typedef struct { const char* name; int subsystem; } Owner;
+typedef struct { unsigned int addr, size; int region, copied, subsystem; } Symbol;
+typedef struct { const char* name; int subsystem, region; unsigned int limit; } Budget;
+
+static Subsystem subsystems[MAX_SUBSYSTEMS];
+static int num_subsystems;
+
+typedef struct { unsigned char* data; long size; const char* path; } Elf;
+
+static unsigned int get16(const unsigned char* p) { return p[0] | p[1] << 8; }
+static unsigned int get32(const unsigned char* p) { return p[0] | p[1] << 8 | p[2] << 16 | (unsigned int)p[3] << 24; }
+
+static int elf_load(Elf* elf, const char* path) {
+    FILE* f = fopen(path, "rb");
+    if (!f) { perror(path); return 0; }
+    fseek(f, 0, SEEK_END);
+    elf->size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    elf->data = malloc(elf->size > 52 ? elf->size : 52);
+    elf->path = path;
+    int ok = fread(elf->data, 1, elf->size, f) == (size_t)elf->size;
+    fclose(f);
+    if (!ok || elf->size < 52 || memcmp(elf->data, "\177ELF", 4) || elf->data[4] != 1 || elf->data[5] != 1) {
+        fprintf(stderr, "memreport: %s: not a 32-bit little-endian ELF file\n", path);
+        return 0;
+    }
+    unsigned int shoff = get32(elf->data + 32), shnum = get16(elf->data + 48);
+    if (get16(elf->data + 46) != 40 || shoff + (unsigned long)shnum * 40 > (unsigned long)elf->size) {
+        fprintf(stderr, "memreport: %s: bad section headers\n", path);
+        return 0;
+    }
+    return 1;
+}
+
+static int elf_sections(const Elf* elf) { return get16(elf->data + 48); }
+static const unsigned char* elf_section(const Elf* elf, int i) { return elf->data + get32(elf->data + 32) + i * 40; }
+
+// The symbol table and its string table, or 0 if the file has none.
+static const unsigned char* elf_symtab(const Elf* elf, int* count, const char** strings) {
+    for (int i = 0; i < elf_sections(elf); i++) {
+        const unsigned char* sh = elf_section(elf, i);
+        if (get32(sh + 4) != SHT_SYMTAB) continue;
+        const unsigned char* str = elf_section(elf, get32(sh + 24));
+        unsigned int offset = get32(sh + 16), size = get32(sh + 20);
+        if (offset + size > (unsigned long)elf->size || get32(str + 16) + get32(str + 20) > (unsigned long)elf->size) break;
+        *count = size / 16;
+        *strings = (const char*)elf->data + get32(str + 16);
+        return elf->data + offset;
+    }
+    fprintf(stderr, "memreport: %s: no symbol table\n", elf->path);
+    return 0;
+}
+
+static int region_of(unsigned int addr) {
+    switch (addr >> 24) {
+    case 0x02: return REGION_EWRAM;
+    case 0x03: return REGION_IWRAM;
+    case 0x08: case 0x09: return REGION_ROM;
+    }
+    return -1;
+}
+
+static int subsystem_index(const char* name) {
+    for (int i = 0; i < num_subsystems; i++) if (!strcmp(subsystems[i].name, name)) return i;
+    if (num_subsystems == MAX_SUBSYSTEMS) { fprintf(stderr, "memreport: more than %d subsystems\n", MAX_SUBSYSTEMS); exit(1); }
+    subsystems[num_subsystems].name = name;
+    return num_subsystems++;
+}
+
+// "build/transform.iwram.o" -> "transform"
+static const char* object_stem(const char* path) {
+    const char* base = strrchr(path, '/');
+    base = base ? base + 1 : path;
+    char* stem = malloc(strlen(base) + 1);
+    strcpy(stem, base);
+    char* dot = strchr(stem, '.');
+    if (dot) *dot = 0;
+    return stem;
+}
+
+static int find_owner(const Owner* owners, int n, const char* name) {
+    for (int i = 0; i < n; i++) if (!strcmp(owners[i].name, name)) return owners[i].subsystem;
+    return -1;
+}
+
+static int compare_symbols(const void* pa, const void* pb) {
+    const Symbol* a = pa;
+    const Symbol* b = pb;
+    return (a->addr > b->addr) - (a->addr < b->addr);
+}
+
+static int compare_subsystems(const void* pa, const void* pb) {
+    const Subsystem* a = pa;
+    const Subsystem* b = pb;
+    unsigned int ta = a->bytes[0] + a->bytes[1] + a->bytes[2], tb = b->bytes[0] + b->bytes[1] + b->bytes[2];
+    return (ta < tb) - (ta > tb);
+}
+
+static int parse_budget(const char* arg, Budget* b) {
+    const char* eq = strchr(arg, '=');
+    if (!eq) return 0;
+    char key[64];
+    int len = eq - arg;
+    if (len <= 0 || len >= (int)sizeof(key)) return 0;
+    memcpy(key, arg, len);
+    key[len] = 0;
+    char* label = malloc(len + 1);
+    strcpy(label, key);
+    char* dot = strrchr(key, '.');
+    const char* region = dot ? dot + 1 : key;
+    if (dot) *dot = 0;
+    b->region = -1;
+    for (int r = 0; r < NUM_REGIONS; r++) if (!strcmp(region, region_names[r])) b->region = r;
+    if (b->region < 0) return 0;
+    b->name = label;
+    b->subsystem = -1;
+    if (dot) {
+        char* name = malloc(strlen(key) + 1);
+        strcpy(name, key);
+        b->subsystem = subsystem_index(name);
+    }
+    char* end;
+    b->limit = strtoul(eq + 1, &end, 0);
+    return *end == 0 && end != eq + 1;
+}
+
+int main(int argc, char** argv) {
+    Budget budgets[MAX_BUDGETS];
+    int num_budgets = 0, argi = 1;
+    for (; argi + 1 < argc && !strcmp(argv[argi], "-b"); argi += 2) {
+        if (num_budgets == MAX_BUDGETS || !parse_budget(argv[argi + 1], &budgets[num_budgets])) {
+            fprintf(stderr, "memreport: bad budget %s\n", argv[argi + 1]);
+            return 1;
+        }
+        num_budgets++;
+    }
+    if (argi >= argc) {
+        fprintf(stderr, "usage: memreport [-b budget=bytes]... elf [-s subsystem] object...\n"
+                        "  budgets: rom, iwram, ewram, or <subsystem>.<region>\n");
+        return 1;
+    }
+    Elf image;
+    if (!elf_load(&image, argv[argi++])) return 1;
+
+    // Owners of every global, and of the locals after each FILE symbol.
+    int max_owners = 0, num_globals = 0, num_files = 0;
+    Owner* globals = 0;
+    Owner* files = 0;
+    for (const char* group = 0; argi < argc; argi++) {
+        if (!strcmp(argv[argi], "-s") && argi + 1 < argc) { group = argv[++argi]; continue; }
+        Elf obj;
+        if (!elf_load(&obj, argv[argi])) return 1;
+        int count;
+        const char* strings;
+        const unsigned char* syms = elf_symtab(&obj, &count, &strings);
+        if (!syms) return 1;
+        int subsystem = subsystem_index(group ? group : object_stem(argv[argi]));
+        subsystems[subsystem].objects++;
+        if (num_globals + num_files + count > max_owners) {
+            max_owners = 2 * max_owners + count;
+            globals = realloc(globals, max_owners * sizeof(Owner));
+            files = realloc(files, max_owners * sizeof(Owner));
+        }
+        for (int i = 1; i < count; i++) {
+            const unsigned char* s = syms + i * 16;
+            int type = s[12] & 15, bind = s[12] >> 4, shndx = get16(s + 14);
+            const char* name = strings + get32(s);
+            if (type == STT_FILE) files[num_files++] = (Owner){ name, subsystem };
+            else if (bind != 0 && shndx != 0 && *name) globals[num_globals++] = (Owner){ name, subsystem };
+        }
+    }
+    int runtime = subsystem_index("runtime");
+    int other = subsystem_index("other");
+    subsystems[runtime].objects = subsystems[other].objects = 1;
+    for (int b = 0; b < num_budgets; b++) {
+        if (budgets[b].subsystem >= 0 && !subsystems[budgets[b].subsystem].objects) {
+            fprintf(stderr, "memreport: budget %s: no object for subsystem %s\n", budgets[b].name, subsystems[budgets[b].subsystem].name);
+            return 1;
+        }
+    }
+
+    // Region totals from the sections.
+    unsigned int used[NUM_REGIONS] = { 0 }, iwram_end = 0x03000000;
+    for (int i = 0; i < elf_sections(&image); i++) {
+        const unsigned char* sh = elf_section(&image, i);
+        unsigned int addr = get32(sh + 12), size = get32(sh + 20);
+        int region = region_of(addr);
+        if (!(get32(sh + 8) & SHF_ALLOC) || !size || region < 0) continue;
+        used[region] += size;
+        if (region != REGION_ROM && get32(sh + 4) == SHT_PROGBITS) used[REGION_ROM] += size;
+        if (region == REGION_IWRAM && addr + size > iwram_end) iwram_end = addr + size;
+    }
+
+    // Sized symbols, each address once (aliases share it).
+    int count;
+    const char* strings;
+    const unsigned char* syms = elf_symtab(&image, &count, &strings);
+    if (!syms) return 1;
+    Symbol* symbols = malloc(count * sizeof(Symbol));
+    int num_symbols = 0, file_owner = runtime;
+    for (int i = 1; i < count; i++) {
+        const unsigned char* s = syms + i * 16;
+        int type = s[12] & 15, bind = s[12] >> 4, shndx = get16(s + 14);
+        const char* name = strings + get32(s);
+        if (type == STT_FILE) { int o = find_owner(files, num_files, name); file_owner = o < 0 ? runtime : o; continue; }
+        unsigned int addr = get32(s + 4) & ~1u, size = get32(s + 8); // Thumb functions have bit 0 set
+        if ((type != STT_OBJECT && type != STT_FUNC) || !size || !shndx || shndx >= SHN_LORESERVE || shndx >= elf_sections(&image)) continue;
+        const unsigned char* sh = elf_section(&image, shndx);
+        int region = region_of(addr);
+        if (!(get32(sh + 8) & SHF_ALLOC) || region < 0) continue;
+        int owner = bind == 0 ? file_owner : find_owner(globals, num_globals, name);
+        symbols[num_symbols++] = (Symbol){ addr, size, region, region != REGION_ROM && get32(sh + 4) == SHT_PROGBITS, owner < 0 ? runtime : owner };
+    }
+    qsort(symbols, num_symbols, sizeof(Symbol), compare_symbols);
+    unsigned int covered[NUM_REGIONS] = { 0 };
+    for (int i = 0; i < num_symbols; i++) {
+        const Symbol* s = &symbols[i];
+        if (i && s->addr == symbols[i - 1].addr) continue;
+        subsystems[s->subsystem].bytes[s->region] += s->size;
+        covered[s->region] += s->size;
+        if (s->copied) { subsystems[s->subsystem].bytes[REGION_ROM] += s->size; covered[REGION_ROM] += s->size; }
+    }
+    for (int r = 0; r < NUM_REGIONS; r++) subsystems[other].bytes[r] = used[r] > covered[r] ? used[r] - covered[r] : 0;
+
+    // Check the budgets before the sort moves the subsystems.
+    unsigned int actual[MAX_BUDGETS];
+    for (int b = 0; b < num_budgets; b++) {
+        actual[b] = budgets[b].subsystem < 0 ? used[budgets[b].region] : subsystems[budgets[b].subsystem].bytes[budgets[b].region];
+    }
+
+    printf("memreport: %s\n", image.path);
+    printf("%-8s %10s %10s %10s\n", "region", "used", "budget", "size");
+    for (int r = 0; r < NUM_REGIONS; r++) {
+        char budget[16] = "-";
+        for (int b = 0; b < num_budgets; b++) {
+            if (budgets[b].subsystem < 0 && budgets[b].region == r) snprintf(budget, sizeof(budget), "%u", budgets[b].limit);
+        }
+        printf("%-8s %10u %10s %10u\n", region_names[r], used[r], budget, region_sizes[r]);
+    }
+    if (used[REGION_IWRAM]) printf("stack: %u bytes of IWRAM free below the user stack top\n", iwram_end < USER_STACK_TOP ? USER_STACK_TOP - iwram_end : 0);
+    printf("\n%-12s %8s %8s %8s\n", "subsystem", "rom", "iwram", "ewram");
+    qsort(subsystems, num_subsystems, sizeof(Subsystem), compare_subsystems);
+    for (int i = 0; i < num_subsystems; i++) {
+        const Subsystem* s = &subsystems[i];
+        if (s->bytes[0] + s->bytes[1] + s->bytes[2]) printf("%-12s %8u %8u %8u\n", s->name, s->bytes[0], s->bytes[1], s->bytes[2]);
+    }
+
+    fflush(stdout);
+    int ok = 1;
+    for (int b = 0; b < num_budgets; b++) {
+        if (actual[b] <= budgets[b].limit) continue;
+        fprintf(stderr, "memreport: %s over budget: %u bytes, %u over\n", budgets[b].name, actual[b], actual[b] - budgets[b].limit);
+        ok = 0;
+    }
+    return ok ? 0 : 1;
+}
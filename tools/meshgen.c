@@ -0,0 +1,57 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "surface.h"
+#include "meshpack.h"
+
+// Build-time parametric mesh baker (see include/surface.h).
+//
+//   meshgen [-n name] [-b] type u v a b output
+//
+// Generates the surface with source/surface.c, the fixed-point code the
+// runtime generator uses, so the baked vertices and faces match what
+// mesh_generate() builds on the device bit for bit. The edges are packed
+// like objconv's (tools/meshpack.c) into a mesh blob centred on the origin;
+// output is C source holding the blob as a word array (default) or, with
+// -b, the raw little-endian blob.
+
+int main(int argc, char** argv) {
+    const char* name = 0;
+    int binary = 0, argi = 1;
+    for (; argi < argc && argv[argi][0] == '-'; argi++) {
+        if (!strcmp(argv[argi], "-n") && argi + 1 < argc) name = argv[++argi];
+        else if (!strcmp(argv[argi], "-b")) binary = 1;
+        else break;
+    }
+    if (argc - argi != 6) {
+        fprintf(stderr, "usage: meshgen [-n name] [-b] type u v a b output\n  types:");
+        for (int t = 0; t < NUM_SURFACES; t++) fprintf(stderr, " %s", surface_names[t]);
+        fprintf(stderr, "\n");
+        return 1;
+    }
+    int type = 0;
+    while (type < NUM_SURFACES && strcmp(argv[argi], surface_names[type])) type++;
+    if (type == NUM_SURFACES) { fprintf(stderr, "meshgen: unknown surface type %s\n", argv[argi]); return 1; }
+    int u = atoi(argv[argi + 1]), v = atoi(argv[argi + 2]), a = atoi(argv[argi + 3]), b = atoi(argv[argi + 4]);
+    const char* out_path = argv[argi + 5];
+    char source[128];
+    snprintf(source, sizeof(source), "%s %d %d %d %d", surface_names[type], u, v, a, b);
+
+    SurfaceSize sz;
+    if (!surface_size(type, u, v, &sz)) { fprintf(stderr, "meshgen: %s: segment counts out of range\n", source); return 1; }
+    if (a < 0 || b < 0 || a + b > 16383) { fprintf(stderr, "meshgen: %s: radii out of range\n", source); return 1; }
+    short* v3[3];
+    for (int k = 0; k < 3; k++) v3[k] = malloc(sz.num_vertices * sizeof(short));
+    unsigned short (*edges)[2] = malloc(sz.num_edges * sizeof(*edges));
+    unsigned short (*faces)[4] = malloc((sz.num_faces + 1) * sizeof(*faces));
+    surface_build(type, u, v, a, b, v3[0], v3[1], v3[2], edges, faces);
+    int radius = surface_radius(v3[0], v3[1], v3[2], sz.num_vertices);
+
+    PackMesh mesh = { sz.num_vertices, { v3[0], v3[1], v3[2] }, sz.num_edges, (const unsigned short (*)[2])edges,
+                      sz.num_faces, (const unsigned short (*)[4])faces, radius, { 0, 0, 0 }, 1.0 };
+    PackInfo info;
+    if (!meshpack_write(&mesh, out_path, name, binary, "meshgen", source, &info)) return 1;
+    fprintf(stderr, "%s: %d vertices, %d edges in %d strips (%d entries), u%d indices, %d faces, radius %d, %d bytes\n",
+            source, sz.num_vertices, sz.num_edges, info.num_strips, info.entries, info.index_size * 8, sz.num_faces, radius, info.size);
+    return 0;
+}
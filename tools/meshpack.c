@@ -0,0 +1,89 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "meshblob.h"
+#include "strip.h"
+#include "meshpack.h"
+
+static void put16(unsigned char* p, unsigned int v) { p[0] = v; p[1] = v >> 8; }
+static void put32(unsigned char* p, unsigned int v) { p[0] = v; p[1] = v >> 8; p[2] = v >> 16; p[3] = v >> 24; }
+static int align4(int n) { return (n + 3) & ~3; }
+
+unsigned char* meshpack_blob(const PackMesh* m, const char* source, PackInfo* info) {
+    int num_vertices = m->num_vertices, num_edges = m->num_edges, num_faces = m->num_faces;
+    if (num_vertices > 65535) { fprintf(stderr, "%s: %d vertices, at most 65535 supported\n", source, num_vertices); return 0; }
+    if (num_edges > 65535) { fprintf(stderr, "%s: %d edges, at most 65535 supported\n", source, num_edges); return 0; }
+    if (num_faces > 65534) { fprintf(stderr, "%s: %d faces, at most 65534 supported\n", source, num_faces); return 0; }
+
+    // Strips: u8 indices (and counts) when every vertex fits, else u16.
+    int index_size = num_vertices <= 256 ? 1 : 2;
+    int max_len = index_size == 1 ? 255 : 65535;
+    int capacity = STRIP_MAX_ENTRIES(num_vertices, num_edges, max_len), entries;
+    unsigned short* strips = malloc(capacity * sizeof(unsigned short));
+    int* scratch = malloc(STRIP_SCRATCH_WORDS(num_vertices, num_edges) * sizeof(int));
+    int num_strips = strip_build(m->edges, num_edges, num_vertices, max_len, strips, capacity, &entries, scratch);
+    if (num_strips < 0 || num_strips > 65535) { fprintf(stderr, "%s: strip cover failed\n", source); free(scratch); free(strips); return 0; }
+
+    // The faces next to each strip edge.
+    unsigned short (*edge_faces)[2] = malloc((num_edges + 1) * sizeof(*edge_faces));
+    int* face_scratch = malloc(STRIP_FACE_SCRATCH_WORDS(num_vertices, num_faces) * sizeof(int));
+    if (num_faces) strip_edge_faces(strips, num_strips, m->faces, num_faces, num_vertices, edge_faces, face_scratch);
+
+    // Pack: header, x/y/z streams, the strips and the face data, each 4-byte aligned.
+    int stream = align4(num_vertices * 2);
+    int x_offset = MESH_BLOB_HEADER_SIZE, y_offset = x_offset + stream, z_offset = y_offset + stream, strip_offset = z_offset + stream;
+    int face_offset = num_faces ? align4(strip_offset + entries * index_size) : 0;
+    int edge_face_offset = num_faces ? face_offset + num_faces * 8 : 0;
+    int size = num_faces ? edge_face_offset + num_edges * 4 : align4(strip_offset + entries * index_size);
+    unsigned char* blob = calloc(size, 1);
+    put32(blob + 0, MESH_BLOB_MAGIC);
+    put32(blob + 4, size);
+    put16(blob + 8, num_vertices); put16(blob + 10, num_edges);
+    blob[12] = index_size;
+    blob[13] = m->shift;
+    put16(blob + 14, m->radius);
+    put16(blob + 16, m->center[0]); put16(blob + 18, m->center[1]); put16(blob + 20, m->center[2]);
+    put16(blob + 22, num_strips);
+    put32(blob + 24, (unsigned int)lround(m->scale * 65536));
+    put32(blob + 28, x_offset); put32(blob + 32, y_offset); put32(blob + 36, z_offset); put32(blob + 40, strip_offset);
+    put16(blob + 44, num_faces);
+    put32(blob + 48, face_offset); put32(blob + 52, edge_face_offset);
+    for (int i = 0; i < num_vertices; i++) {
+        put16(blob + x_offset + i * 2, m->v[0][i]); put16(blob + y_offset + i * 2, m->v[1][i]); put16(blob + z_offset + i * 2, m->v[2][i]);
+    }
+    for (int i = 0; i < entries; i++) {
+        if (index_size == 1) blob[strip_offset + i] = strips[i];
+        else put16(blob + strip_offset + i * 2, strips[i]);
+    }
+    for (int f = 0; f < num_faces; f++) for (int k = 0; k < 4; k++) put16(blob + face_offset + f * 8 + k * 2, m->faces[f][k]);
+    for (int e = 0; num_faces && e < num_edges; e++) { put16(blob + edge_face_offset + e * 4, edge_faces[e][0]); put16(blob + edge_face_offset + e * 4 + 2, edge_faces[e][1]); }
+    *info = (PackInfo){ num_strips, entries, index_size, size };
+    free(face_scratch); free(edge_faces); free(scratch); free(strips);
+    return blob;
+}
+
+void meshpack_emit(FILE* f, const char* name, const unsigned char* blob, int size) {
+    fprintf(f, "const unsigned int %s[%d] = {\n", name, size / 4);
+    for (int i = 0; i < size; i += 4) {
+        unsigned int w = blob[i] | blob[i + 1] << 8 | blob[i + 2] << 16 | (unsigned int)blob[i + 3] << 24;
+        fprintf(f, "%s0x%08X,%s", (i % 32) ? " " : "    ", w, (i % 32 == 28 || i + 4 == size) ? "\n" : "");
+    }
+    fprintf(f, "};\n");
+}
+
+int meshpack_write(const PackMesh* m, const char* path, const char* name, int binary,
+                   const char* tool, const char* source, PackInfo* info) {
+    unsigned char* blob = meshpack_blob(m, source, info);
+    if (!blob) return 0;
+    FILE* f = fopen(path, binary ? "wb" : "w");
+    if (!f) { perror(path); free(blob); return 0; }
+    if (binary) {
+        fwrite(blob, 1, info->size, f);
+    } else {
+        fprintf(f, "// Generated by tools/%s from %s: %d vertices, %d edges in %d strips, u%d indices, %d faces.\n", tool, source, m->num_vertices, m->num_edges, info->num_strips, info->index_size * 8, m->num_faces);
+        meshpack_emit(f, name ? name : "mesh_blob", blob, info->size);
+    }
+    fclose(f);
+    free(blob);
+    return 1;
+}
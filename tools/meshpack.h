@@ -0,0 +1,38 @@
+#ifndef MESHPACK_H
+#define MESHPACK_H
+
+#include <stdio.h>
+
+// Blob packing shared by the offline mesh tools (objconv, meshgen): covers
+// a quantized mesh's edges by strips (source/strip.c), lays it out as a
+// packed mesh blob (include/meshblob.h) and writes it out.
+
+typedef struct {
+    int num_vertices;
+    const short* v[3];                     // x, y, z
+    int num_edges;                         // Unique and undirected
+    const unsigned short (*edges)[2];
+    int num_faces;                         // 0 without face data
+    const unsigned short (*faces)[4];
+    int radius;                            // Bounding sphere, model units
+    short center[3];
+    double scale;                          // Model units per source unit
+    int shift;                             // v holds model units << shift
+} PackMesh;
+
+typedef struct { int num_strips, entries, index_size, size; } PackInfo;
+
+// The packed blob, malloc'ed, with its layout in info. Returns 0 with a
+// message on stderr (naming source) if the mesh cannot be packed.
+unsigned char* meshpack_blob(const PackMesh* mesh, const char* source, PackInfo* info);
+
+// Prints a blob of size bytes as `const unsigned int name[]`.
+void meshpack_emit(FILE* f, const char* name, const unsigned char* blob, int size);
+
+// Writes the blob to path as C source declaring `const unsigned int name[]`
+// under a "Generated by tools/<tool> from <source>" comment, or with binary
+// as the raw little-endian blob. Returns 0 with a message on stderr on failure.
+int meshpack_write(const PackMesh* mesh, const char* path, const char* name, int binary,
+                   const char* tool, const char* source, PackInfo* info);
+
+#endif // MESHPACK_H
@@ -0,0 +1,242 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "meshblob.h"
+#include "meshpack.h"
+
+// Offline Wavefront OBJ to packed mesh blob converter (see include/meshblob.h).
+//
+//   objconv [-s scale | -r radius] [-n name] [-b] input.obj output
+//
+// Vertices are scaled into model units, then stored as short with as many
+// fraction bits as fit (the blob's shift). Only exact duplicates in the OBJ
+// are merged; distinct vertices that still round to one position are kept,
+// with a warning. Edges are collected from
+// every face ("f") and polyline ("l") element, made undirected and de-duplicated,
+// then covered by edge strips (source/strip.c, shared with the runtime) and
+// packed by tools/meshpack.c.
+// Every face is also kept as a quad for hidden-line removal: its vertices
+// at 0, n/4, n/2 and 3n/4, which keep the winding of a convex polygon
+// (a triangle repeats a vertex).
+// Output is C source holding the blob as a word array (default) or, with -b,
+// the raw little-endian blob.
+
+#define DEFAULT_RADIUS 52 // Bounding radius of the built-in 60-unit cube
+#define MAX_SHIFT 15
+
+typedef struct { double x, y, z; } Vec3;
+typedef struct { short x, y, z; int index; } QVertex;
+typedef struct { unsigned short a, b; } Edge;
+
+static Vec3* in_vertices;
+static int num_in_vertices, cap_in_vertices;
+static int (*in_edges)[2];
+static int num_in_edges, cap_in_edges;
+static int (*in_faces)[4];
+static int num_in_faces, cap_in_faces;
+static int* element; // Vertex indices of the element being read
+static int cap_element;
+
+static void* grow(void* p, int* cap, int need, size_t size) {
+    if (need <= *cap) return p;
+    *cap = *cap ? *cap * 2 : 256;
+    if (*cap < need) *cap = need;
+    p = realloc(p, *cap * size);
+    if (!p) { fprintf(stderr, "objconv: out of memory\n"); exit(1); }
+    return p;
+}
+
+static void add_in_edge(int a, int b) {
+    in_edges = grow(in_edges, &cap_in_edges, num_in_edges + 1, sizeof(*in_edges));
+    in_edges[num_in_edges][0] = a; in_edges[num_in_edges][1] = b;
+    num_in_edges++;
+}
+
+// OBJ indices are 1-based; negative ones count back from the last vertex.
+static int resolve_index(const char* token, const char* path, int line) {
+    int i = atoi(token);
+    if (i < 0) i += num_in_vertices; else i -= 1;
+    if (i < 0 || i >= num_in_vertices) { fprintf(stderr, "%s:%d: vertex index %s out of range\n", path, line, token); exit(1); }
+    return i;
+}
+
+static void read_obj(const char* path) {
+    FILE* f = fopen(path, "r");
+    if (!f) { perror(path); exit(1); }
+    char buf[4096];
+    for (int line = 1; fgets(buf, sizeof(buf), f); line++) {
+        char* tok = strtok(buf, " \t\r\n");
+        if (!tok) continue;
+        if (!strcmp(tok, "v")) {
+            Vec3 v = { 0, 0, 0 };
+            char* s;
+            if ((s = strtok(0, " \t\r\n"))) v.x = atof(s);
+            if ((s = strtok(0, " \t\r\n"))) v.y = atof(s);
+            if ((s = strtok(0, " \t\r\n"))) v.z = atof(s);
+            in_vertices = grow(in_vertices, &cap_in_vertices, num_in_vertices + 1, sizeof(Vec3));
+            in_vertices[num_in_vertices++] = v;
+        } else if (!strcmp(tok, "f") || !strcmp(tok, "l")) {
+            int closed = tok[0] == 'f', n = 0;
+            char* s;
+            while ((s = strtok(0, " \t\r\n"))) {
+                element = grow(element, &cap_element, n + 1, sizeof(int));
+                element[n++] = resolve_index(s, path, line); // "v/vt/vn": atoi stops at the slash
+            }
+            // A face may repeat its first vertex to close itself.
+            if (closed && n > 1 && element[n - 1] == element[0]) n--;
+            for (int j = 1; j < n; j++) add_in_edge(element[j - 1], element[j]);
+            if (closed && n > 2) add_in_edge(element[n - 1], element[0]);
+            if (closed && n >= 3) {
+                in_faces = grow(in_faces, &cap_in_faces, num_in_faces + 1, sizeof(*in_faces));
+                for (int k = 0; k < 4; k++) in_faces[num_in_faces][k] = element[k * n / 4];
+                num_in_faces++;
+            }
+        }
+    }
+    fclose(f);
+    if (!num_in_vertices) { fprintf(stderr, "%s: no vertices\n", path); exit(1); }
+}
+
+static int compare_position(const Vec3* a, const Vec3* b) {
+    if (a->x != b->x) return a->x < b->x ? -1 : 1;
+    if (a->y != b->y) return a->y < b->y ? -1 : 1;
+    return a->z != b->z ? (a->z < b->z ? -1 : 1) : 0;
+}
+
+// Source vertex indices by position, then index.
+static int compare_in_vertex(const void* pa, const void* pb) {
+    int a = *(const int*)pa, b = *(const int*)pb;
+    int c = compare_position(&in_vertices[a], &in_vertices[b]);
+    return c ? c : a - b;
+}
+
+static int compare_qvertex(const void* pa, const void* pb) {
+    const QVertex* a = pa; const QVertex* b = pb;
+    if (a->x != b->x) return a->x - b->x;
+    if (a->y != b->y) return a->y - b->y;
+    if (a->z != b->z) return a->z - b->z;
+    return a->index - b->index;
+}
+
+static int compare_edge(const void* pa, const void* pb) {
+    const Edge* a = pa; const Edge* b = pb;
+    return a->a != b->a ? a->a - b->a : a->b - b->b;
+}
+
+int main(int argc, char** argv) {
+    double scale = 0, radius = DEFAULT_RADIUS;
+    const char* name = 0;
+    int binary = 0, argi = 1;
+    for (; argi < argc && argv[argi][0] == '-'; argi++) {
+        if (!strcmp(argv[argi], "-s") && argi + 1 < argc) scale = atof(argv[++argi]);
+        else if (!strcmp(argv[argi], "-r") && argi + 1 < argc) radius = atof(argv[++argi]);
+        else if (!strcmp(argv[argi], "-n") && argi + 1 < argc) name = argv[++argi];
+        else if (!strcmp(argv[argi], "-b")) binary = 1;
+        else break;
+    }
+    if (argc - argi != 2) {
+        fprintf(stderr, "usage: objconv [-s scale | -r radius] [-n name] [-b] input.obj output\n");
+        return 1;
+    }
+    const char* in_path = argv[argi];
+    const char* out_path = argv[argi + 1];
+    read_obj(in_path);
+
+    // Scale-aware quantization: unless given explicitly, pick the scale that
+    // maps the farthest vertex from the origin (the model's pivot) to radius.
+    if (scale <= 0) {
+        double far = 0;
+        for (int i = 0; i < num_in_vertices; i++) {
+            Vec3 v = in_vertices[i];
+            double d = sqrt(v.x * v.x + v.y * v.y + v.z * v.z);
+            if (d > far) far = d;
+        }
+        scale = far > 0 ? radius / far : 1;
+    }
+    double extent = 0;
+    for (int i = 0; i < num_in_vertices; i++) {
+        Vec3 v = in_vertices[i];
+        extent = fmax(extent, fmax(fabs(v.x), fmax(fabs(v.y), fabs(v.z))) * scale);
+    }
+    if (lround(extent) > 32767) { fprintf(stderr, "%s: coordinate %g does not fit in short at scale %g\n", in_path, extent, scale); return 1; }
+    // Coordinates are stored with as many fraction bits as the largest one
+    // leaves room for, as model units << shift; transform_mesh() folds the
+    // shift into the matrix, so a small model keeps the source's detail.
+    int shift = 0;
+    while (shift < MAX_SHIFT && lround(extent * (2 << shift)) <= 32767) shift++;
+    double quantum = scale * (1 << shift);
+
+    // Merge exact duplicates only, keeping first-seen order for the survivors.
+    int* order = malloc(num_in_vertices * sizeof(int));
+    for (int i = 0; i < num_in_vertices; i++) order[i] = i;
+    qsort(order, num_in_vertices, sizeof(int), compare_in_vertex);
+    int* canonical = malloc(num_in_vertices * sizeof(int));
+    for (int i = 0, first = 0; i < num_in_vertices; i++) {
+        if (!i || compare_position(&in_vertices[order[i]], &in_vertices[order[i - 1]])) first = order[i];
+        canonical[order[i]] = first;
+    }
+    int* remap = malloc(num_in_vertices * sizeof(int));
+    short* out_v[3];
+    for (int k = 0; k < 3; k++) out_v[k] = malloc(num_in_vertices * sizeof(short));
+    QVertex* q = malloc(num_in_vertices * sizeof(QVertex));
+    int num_vertices = 0;
+    for (int i = 0; i < num_in_vertices; i++) {
+        if (canonical[i] != i) { remap[i] = remap[canonical[i]]; continue; }
+        remap[i] = num_vertices;
+        Vec3 v = in_vertices[i];
+        q[num_vertices] = (QVertex){ lround(v.x * quantum), lround(v.y * quantum), lround(v.z * quantum), num_vertices };
+        out_v[0][num_vertices] = q[num_vertices].x; out_v[1][num_vertices] = q[num_vertices].y; out_v[2][num_vertices] = q[num_vertices].z;
+        num_vertices++;
+    }
+    if (num_vertices > 65535) { fprintf(stderr, "%s: %d vertices, at most 65535 supported\n", in_path, num_vertices); return 1; }
+
+    // Distinct vertices closer than the quantum stay distinct, but their
+    // edges become points.
+    qsort(q, num_vertices, sizeof(QVertex), compare_qvertex);
+    int collided = 0;
+    for (int i = 1; i < num_vertices; i++) collided += q[i].x == q[i - 1].x && q[i].y == q[i - 1].y && q[i].z == q[i - 1].z;
+    if (collided) fprintf(stderr, "%s: warning: %d distinct vertices share a quantized position with another\n", in_path, collided);
+
+    // Unique undirected edges; edges between copies of one vertex are dropped.
+    Edge* edges = malloc((num_in_edges + 1) * sizeof(Edge));
+    int num_edges = 0;
+    for (int i = 0; i < num_in_edges; i++) {
+        int a = remap[in_edges[i][0]], b = remap[in_edges[i][1]];
+        if (a == b) continue;
+        edges[num_edges].a = a < b ? a : b; edges[num_edges].b = a < b ? b : a;
+        num_edges++;
+    }
+    qsort(edges, num_edges, sizeof(Edge), compare_edge);
+    int unique = 0;
+    for (int i = 0; i < num_edges; i++) if (!unique || compare_edge(&edges[i], &edges[unique - 1])) edges[unique++] = edges[i];
+    num_edges = unique;
+    if (num_edges > 65535) { fprintf(stderr, "%s: %d edges, at most 65535 supported\n", in_path, num_edges); return 1; }
+
+    // Bounding sphere around the box centre, in model units, radius rounded up.
+    int lo[3], hi[3], center[3];
+    double unit = 1.0 / (1 << shift);
+    for (int k = 0; k < 3; k++) {
+        lo[k] = hi[k] = out_v[k][0];
+        for (int i = 1; i < num_vertices; i++) { if (out_v[k][i] < lo[k]) lo[k] = out_v[k][i]; if (out_v[k][i] > hi[k]) hi[k] = out_v[k][i]; }
+        center[k] = lround((lo[k] + hi[k]) * unit / 2);
+    }
+    double r2 = 0;
+    for (int i = 0; i < num_vertices; i++) {
+        double dx = out_v[0][i] * unit - center[0], dy = out_v[1][i] * unit - center[1], dz = out_v[2][i] * unit - center[2];
+        if (dx * dx + dy * dy + dz * dz > r2) r2 = dx * dx + dy * dy + dz * dz;
+    }
+    int bound = (int)ceil(sqrt(r2));
+
+    // Faces on merged vertices.
+    unsigned short (*faces)[4] = malloc((num_in_faces + 1) * sizeof(*faces));
+    for (int f = 0; f < num_in_faces; f++) for (int k = 0; k < 4; k++) faces[f][k] = remap[in_faces[f][k]];
+
+    PackMesh mesh = { num_vertices, { out_v[0], out_v[1], out_v[2] }, num_edges, (const unsigned short (*)[2])edges,
+                      num_in_faces, (const unsigned short (*)[4])faces, bound, { center[0], center[1], center[2] }, scale, shift };
+    PackInfo info;
+    if (!meshpack_write(&mesh, out_path, name, binary, "objconv", in_path, &info)) return 1;
+    fprintf(stderr, "%s: %d -> %d vertices, %d edges in %d strips (%d entries), u%d indices, %d faces, radius %d, shift %d, %d bytes\n",
+            in_path, num_in_vertices, num_vertices, num_edges, info.num_strips, info.entries, info.index_size * 8, num_in_faces, bound, shift, info.size);
+    return 0;
+}